@@ -0,0 +1,56 @@
+#version 330 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 texcoord;
+layout (location = 3) in uvec4 joint;
+layout (location = 4) in vec4 weight;
+
+// per-instance data: transform rows, baked clip (first texel, frame count) and time offset
+layout (location = 5) in vec4 instance_row0;
+layout (location = 6) in vec4 instance_row1;
+layout (location = 7) in vec4 instance_row2;
+layout (location = 8) in ivec2 instance_clip;
+layout (location = 9) in float instance_time_offset;
+
+// baked frames of every clip, each frame holds the joints of all skinned meshes
+uniform samplerBuffer joint_palette;
+uniform int joint_offset;
+uniform int frame_stride;
+uniform float frames_per_second;
+uniform float time;
+// per-frame camera data shared by every program (binding point 0)
+layout (std140) uniform Camera
+{
+    mat4 projection;
+    mat4 view;
+};
+
+out VS_OUT
+{
+    vec2 texcoord;
+} vs_out;
+
+mat3x4 bone_matrix(int frame_texel, uint id)
+{
+    int texel = frame_texel + int(id) * 3;
+    return mat3x4(texelFetch(joint_palette, texel), texelFetch(joint_palette, texel + 1), texelFetch(joint_palette, texel + 2));
+}
+
+void main()
+{
+    // NOTE: the baked frames are not interpolated, like the keys of Model::UpdateAnimation()
+    int frame = int(mod(floor((time + instance_time_offset) * frames_per_second), float(instance_clip.y)));
+    int frame_texel = instance_clip.x + frame * frame_stride + joint_offset;
+
+    mat3x4 bond_transform = bone_matrix(frame_texel, joint[0]) * weight[0];
+    bond_transform += bone_matrix(frame_texel, joint[1]) * weight[1];
+    bond_transform += bone_matrix(frame_texel, joint[2]) * weight[2];
+    bond_transform += bone_matrix(frame_texel, joint[3]) * weight[3];
+
+    vec4 bone_position = vec4(vec4(position, 1.0) * bond_transform, 1.0);
+    vec4 world_position = vec4(bone_position * mat3x4(instance_row0, instance_row1, instance_row2), 1.0);
+
+    vs_out.texcoord = texcoord;
+    gl_Position = projection * view * world_position;
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#version 330 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 texcoord;
+layout (location = 3) in uvec4 joint;
+layout (location = 4) in vec4 weight;
+
+// each joint is 2 texels of the joint palette: the real part and the dual part,
+// both stored as (w, x, y, z)
+uniform samplerBuffer joint_palette;
+uniform int joint_offset;
+// per-frame camera data shared by every program (binding point 0)
+layout (std140) uniform Camera
+{
+    mat4 projection;
+    mat4 view;
+};
+
+out VS_OUT
+{
+    vec2 texcoord;
+} vs_out;
+
+mat2x4 bone_dual_quaternion(uint id)
+{
+    int texel = joint_offset + int(id) * 2;
+    return mat2x4(texelFetch(joint_palette, texel), texelFetch(joint_palette, texel + 1));
+}
+
+void main()
+{
+    // blend in the hemisphere of the first joint so that q and -q do not cancel out
+    mat2x4 dq0 = bone_dual_quaternion(joint[0]);
+    mat2x4 dq1 = bone_dual_quaternion(joint[1]);
+    mat2x4 dq2 = bone_dual_quaternion(joint[2]);
+    mat2x4 dq3 = bone_dual_quaternion(joint[3]);
+
+    mat2x4 blend_dq = dq0 * weight[0];
+    blend_dq += dq1 * (dot(dq0[0], dq1[0]) < 0.0 ? -weight[1] : weight[1]);
+    blend_dq += dq2 * (dot(dq0[0], dq2[0]) < 0.0 ? -weight[2] : weight[2]);
+    blend_dq += dq3 * (dot(dq0[0], dq3[0]) < 0.0 ? -weight[3] : weight[3]);
+    blend_dq /= length(blend_dq[0]);
+
+    vec4 real = blend_dq[0].yzwx;
+    vec4 dual = blend_dq[1].yzwx;
+    vec3 bone_position = position + 2.0 * cross(real.xyz, cross(real.xyz, position) + real.w * position);
+    bone_position += 2.0 * (real.w * dual.xyz - dual.w * real.xyz + cross(real.xyz, dual.xyz));
+
+    vs_out.texcoord = texcoord;
+    gl_Position = projection * view * vec4(bone_position, 1.0);
+} 
\ No newline at end of file
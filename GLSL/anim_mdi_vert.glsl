@@ -0,0 +1,42 @@
+#version 330 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 texcoord;
+layout (location = 3) in uvec4 joint;
+layout (location = 4) in vec4 weight;
+// per-draw parameters of the indirect command: (joint offset, material id)
+layout (location = 10) in ivec2 draw_parameters;
+
+// each joint matrix is 3 texels of the joint palette (one row per texel)
+uniform samplerBuffer joint_palette;
+// per-frame camera data shared by every program (binding point 0)
+layout (std140) uniform Camera
+{
+    mat4 projection;
+    mat4 view;
+};
+
+out VS_OUT
+{
+    vec2 texcoord;
+} vs_out;
+
+mat3x4 bone_matrix(uint id)
+{
+    int texel = draw_parameters.x + int(id) * 3;
+    return mat3x4(texelFetch(joint_palette, texel), texelFetch(joint_palette, texel + 1), texelFetch(joint_palette, texel + 2));
+}
+
+void main()
+{
+    mat3x4 bond_transform = bone_matrix(joint[0]) * weight[0];
+    bond_transform += bone_matrix(joint[1]) * weight[1];
+    bond_transform += bone_matrix(joint[2]) * weight[2];
+    bond_transform += bone_matrix(joint[3]) * weight[3];
+
+    vec4 bone_position = vec4(vec4(position, 1.0) * bond_transform, 1.0);
+
+    vs_out.texcoord = texcoord;
+    gl_Position = projection * view * bone_position;
+}
\ No newline at end of file
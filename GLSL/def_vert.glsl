@@ -6,8 +6,12 @@ layout (location = 2) in vec2 texcoord;
 layout (location = 3) in uvec4 joint;
 layout (location = 4) in vec4 weight;
 
-uniform mat4 projection;
-uniform mat4 view;
+// per-frame camera data shared by every program (binding point 0)
+layout (std140) uniform Camera
+{
+    mat4 projection;
+    mat4 view;
+};
 
 out VS_OUT
 {
@@ -0,0 +1,123 @@
+/**************************************/
+/*  FILE NAME: asset_cache_bench.cpp  */
+/**************************************/
+
+/**
+ * cost of loading the same character many times: each load parsing the file
+ * into a Scene of its own, against loads through the AssetCache, which parse
+ * it once and give each character an instance (Scene::Instantiate()) sharing
+ * the loaded data. the instances are animated for a frame to show they run
+ * alone. the GL upload is not made here, ModelAsset makes it once per asset
+ * the same way the parse is made once.
+ * 
+ * usage: asset_cache_bench [characters] [rounds]
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <algorithm>
+#include <filesystem>
+
+#include "synthetic_gltf.h"
+#include "Model/scene.h"
+#include "Model/asset_cache.h"
+
+/* returns the time of 'op' in milliseconds, best of 'rounds' */
+template<typename Op>
+double Measure(std::size_t rounds, Op op)
+{
+    double best = 1e30;
+    for(std::size_t round = 0; round < rounds; ++round)
+    {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+/* returns the CPU MiB of 'usage' */
+double CpuMiB(const MemoryUsage& usage)
+{
+    return static_cast<double>(usage.TotalCpu()) / (1024.0 * 1024.0);
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t num_characters = (argc > 1) ? std::stoul(argv[1]) : 200;
+    const std::size_t num_rounds = (argc > 2) ? std::stoul(argv[2]) : 3;
+
+    /* a character of the size of the large input of bench_suite, with a texture */
+    SyntheticOptions options;
+    options.joints = 256;
+    options.vertices = 32768;
+    options.triangles = 32768;
+    options.keys = 240;
+    options.textures = 1;
+    options.texture_size = 512;
+    const std::string file = (std::filesystem::temp_directory_path() / "asset_cache_bench.glb").string();
+    tinygltf::Model model = MakeSyntheticModel(options);
+    WriteSyntheticModel(model, file);
+
+    /* each character loads the file */
+    std::size_t num_parses = 0;
+    double loaded_mib = 0.0;
+    const double loaded_ms = Measure(num_rounds, [&]()
+    {
+        std::vector<std::unique_ptr<Scene>> characters;
+        num_parses = 0;
+        loaded_mib = 0.0;
+        for(std::size_t i = 0; i < num_characters; ++i)
+        {
+            characters.push_back(std::make_unique<Scene>());
+            characters.back()->LoadScene(file);
+            characters.back()->Update(0.016 * static_cast<double>(i));
+            num_parses += 1;
+            loaded_mib += CpuMiB(characters.back()->GetMemoryUsage());
+        }
+    });
+
+    /* each character is an instance of the cached scene, the last one dropped frees it */
+    AssetCache<const Scene>& cache = AssetCache<const Scene>::Get();
+    std::size_t num_misses = 0;
+    double shared_mib = 0.0;
+    double instanced_mib = 0.0;
+    const double instanced_ms = Measure(num_rounds, [&]()
+    {
+        const std::size_t first_misses = cache.NumMisses();
+        std::vector<std::shared_ptr<const Scene>> assets;
+        std::vector<std::unique_ptr<Scene>> characters;
+        instanced_mib = 0.0;
+        for(std::size_t i = 0; i < num_characters; ++i)
+        {
+            assets.push_back(cache.Load(file, AssetLoadOptions(), [](const std::string& canonical_file, const AssetLoadOptions&)
+            {
+                auto scene = std::make_shared<Scene>();
+                scene->LoadScene(canonical_file);
+                return scene;
+            }));
+            characters.push_back(std::make_unique<Scene>());
+            characters.back()->Instantiate(*assets.back());
+            characters.back()->Update(0.016 * static_cast<double>(i));
+            instanced_mib += CpuMiB(characters.back()->GetStateMemoryUsage());
+        }
+        num_misses = cache.NumMisses() - first_misses;
+        shared_mib = CpuMiB(assets.front()->GetMemoryUsage());
+    });
+
+    std::printf("characters: %zu (%u joints, %u vertices, %u triangles)\n", num_characters, options.joints, options.vertices, options.triangles);
+    std::printf("%-10s %8s %12s %12s %12s\n", "", "parses", "ms", "shared MiB", "total MiB");
+    std::printf("%-10s %8zu %12.1f %12.1f %12.1f\n", "loaded", num_parses, loaded_ms, 0.0, loaded_mib);
+    std::printf("%-10s %8zu %12.1f %12.1f %12.1f\n", "instanced", num_misses, instanced_ms, shared_mib, shared_mib + instanced_mib);
+    std::printf("assets alive after the last character: %zu\n", cache.NumAssets());
+
+    std::filesystem::remove(file);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,550 @@
+/********************************/
+/*  FILE NAME: bench_suite.cpp  */
+/********************************/
+
+/**
+ * Microbenchmarks and scenario benchmarks of the core library (gltf_animation_core)
+ * on synthetic models (synthetic_gltf.h, fixed seeds) and on the glTF files given:
+ *  - loader:    tinygltf parsing, accessor decoding (LoadglTFMesh, LoadglTFAnimation), Scene::LoadScene
+ *  - animation: clip sampling (SampleAnimation, as called by Scene::Update)
+ *  - hierarchy: world matrices and joints of the nodes (Scene::UpdateJoints, GetNodeMatrix/UpdateNode)
+ *  - palette:   packing of the joints (Scene::UpdatePalette)
+ *  - scene:     a whole update (Scene::Update) and the snapshot for the render
+ *  - orca:      math kernels (pose to world matrices, skinning, affine products)
+ * every benchmark is calibrated to run at least --min-time per sample and reports the
+ * median and the minimum time per call of --samples samples. the results can be written
+ * as JSON and compared with a baseline written the same way, a median slower than its
+ * baseline by more than --threshold (a ratio) is a regression. a benchmark over the
+ * threshold is measured again, up to --confirm times, and keeps its fastest measurement,
+ * so only a slowdown that shows up every time fails (not a noisy sample set).
+ * the heap allocations and bytes allocated per call are counted too (alloc_tracker.h), the
+ * bytes of a loader benchmark above those it keeps are copies made while loading. with
+ * --expect-no-alloc a benchmark of the steady state (all but loader/) that allocates is an error.
+ *
+ * usage: bench_suite [--gltf <file>]... [--filter <text>] [--samples <count>] [--min-time <ms>]
+ *                    [--output <json>] [--baseline <json>] [--threshold <ratio>] [--confirm <count>]
+ *                    [--expect-no-alloc]
+ * returns 1 if a benchmark regressed or allocated when it should not.
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <map>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#include <json.hpp>
+#include <vector.hpp>
+#include <matrix.hpp>
+#include <affine_functions.hpp>
+#include <dual_quaternion_functions.hpp>
+#include "Model/pose.h"
+#include "Model/scene.h"
+#include "Model/skinning.h"
+#include "Model/gltf_loader.h"
+#include "Profiler/alloc_tracker.h"
+#include "synthetic_gltf.h"
+
+/* one benchmark as reported and stored in the JSON results */
+struct BenchResult
+{
+    std::string name;
+    std::size_t items;          /* items processed by one call (vertices, joints, ...) */
+    std::size_t iterations;     /* calls per sample */
+    std::size_t samples;
+    double median_ns;           /* per call */
+    double min_ns;
+    double allocations;         /* heap allocations per call */
+    double allocated_bytes;     /* bytes of those allocations per call */
+    std::size_t measurements;   /* 1, more if it was measured again over the threshold */
+};
+
+/* a glTF input: its name in the benchmark names, its file and its parsed model */
+struct BenchInput
+{
+    std::string name;
+    std::string file;
+    tinygltf::Model gltf_model;
+};
+
+/* settings from the command line */
+static std::size_t num_samples = 15;
+static double min_sample_ms = 20.0;
+static std::string filter;
+static std::vector<BenchResult> results;
+static std::map<std::string, double> baseline_medians;
+static double threshold = 0.25;
+static std::size_t num_confirmations = 2;
+
+/* written by the benchmarks so that their work is not optimized away */
+static volatile float sink = 0.0f;
+
+/* function to time 'op' (one call processes 'items' items) and append its result            */
+/* NOTE: the calls per sample are doubled until a sample takes 'min_sample_ms', after a call */
+/*       to warm the caches up. a median over the threshold of its baseline is measured     */
+/*       again, up to 'num_confirmations' times, and the fastest measurement is kept        */
+template<typename Op>
+void Run(const std::string& name, std::size_t items, Op op)
+{
+    if(filter.empty() == false && name.find(filter) == std::string::npos)
+        return;
+
+    auto time_calls = [&](std::size_t calls)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for(std::size_t i = 0; i < calls; ++i)
+            op();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    op();
+    std::size_t iterations = 1;
+    while(iterations < (1U << 24) && time_calls(iterations) < min_sample_ms * 1.0e6)
+        iterations *= 2;
+
+    std::vector<double> per_call(num_samples);
+    auto measure = [&]()
+    {
+        const AllocationScope allocation_scope;
+        for(auto& sample : per_call)
+            sample = time_calls(iterations) / static_cast<double>(iterations);
+        const AllocationCounts allocations = allocation_scope.Counts();
+        std::sort(per_call.begin(), per_call.end());
+
+        BenchResult result;
+        result.name = name;
+        result.items = std::max<std::size_t>(items, 1);
+        result.iterations = iterations;
+        result.samples = num_samples;
+        result.median_ns = per_call[per_call.size() / 2];
+        result.min_ns = per_call.front();
+        result.allocations = static_cast<double>(allocations.allocations) / static_cast<double>(iterations * num_samples);
+        result.allocated_bytes = static_cast<double>(allocations.bytes) / static_cast<double>(iterations * num_samples);
+        result.measurements = 1;
+        return result;
+    };
+
+    BenchResult result = measure();
+    const auto baseline = baseline_medians.find(name);
+    while(baseline != baseline_medians.end() && result.median_ns > baseline->second * (1.0 + threshold)
+          && result.measurements <= num_confirmations)
+    {
+        BenchResult again = measure();
+        again.measurements = result.measurements + 1;
+        if(again.median_ns < result.median_ns)
+            result = again;
+        else
+            result.measurements = again.measurements;
+    }
+    results.push_back(result);
+
+    std::printf("%-52s %14.1f ns %14.1f ns %14.4g items/s %10.4g %12.4g%s\n", name.c_str(), result.median_ns, result.min_ns,
+                1.0e9 * static_cast<double>(result.items) / result.median_ns, result.allocations, result.allocated_bytes,
+                (result.measurements > 1) ? ("  (measured " + std::to_string(result.measurements) + " times)").c_str() : "");
+    std::fflush(stdout);
+}
+
+/* function to run the loader, animation, hierarchy, palette and scene benchmarks of an input */
+void RunInput(BenchInput& input)
+{
+    const tinygltf::Model& gltf_model = input.gltf_model;
+
+    std::size_t num_indices = 0;
+    for(const auto& gltf_mesh : gltf_model.meshes)
+    {
+        for(const auto& primitive : gltf_mesh.primitives)
+            num_indices += (primitive.indices > -1) ? gltf_model.accessors[primitive.indices].count : 0;
+    }
+    std::size_t num_channels = 0;
+    for(const auto& gltf_animation : gltf_model.animations)
+        num_channels += gltf_animation.channels.size();
+
+    Run("loader/LoadglTFModel/" + input.name, 1, [&]()
+    {
+        tinygltf::Model parsed;
+        LoadglTFModel(parsed, input.file);
+        sink = sink + static_cast<float>(parsed.accessors.size());
+    });
+    FrameArena scratch;
+    Run("loader/LoadglTFMesh/" + input.name, num_indices, [&]()
+    {
+        for(const auto& gltf_mesh : gltf_model.meshes)
+        {
+            scratch.Reset();
+            sink = sink + static_cast<float>(LoadglTFMesh(gltf_model, gltf_mesh, scratch).vertices.size());
+        }
+    });
+    if(gltf_model.animations.empty() == false)
+    {
+        Run("loader/LoadglTFAnimation/" + input.name, num_channels, [&]()
+        {
+            for(const auto& gltf_animation : gltf_model.animations)
+                sink = sink + LoadglTFAnimation(gltf_model, gltf_animation).end_time;
+        });
+    }
+    Run("loader/LoadScene/" + input.name, 1, [&]()
+    {
+        Scene scene;
+        scene.LoadScene(input.file);
+        sink = sink + static_cast<float>(scene.GetMeshes().size());
+    });
+
+    Scene scene;
+    scene.LoadScene(input.file);
+    scene.UpdateJoints();
+    std::size_t num_joints = 0;
+    for(const auto& mesh : scene.GetMeshes())
+        num_joints += mesh.second.joint_matrices.size();
+
+    if(scene.GetAnimations().empty() == false)
+    {
+        /* a frame of 60 Hz further each call, through the whole clip */
+        const Animation& animation = scene.GetAnimations().begin()->second;
+        const float duration = std::max(animation.end_time - animation.start_time, 1.0e-3f);
+        std::map<int, Node> nodes = scene.GetNodes();
+        float time = 0.0f;
+        Run("animation/SampleAnimation/" + input.name, animation.channels.size(), [&]()
+        {
+            time = std::fmod(time + 1.0f / 60.0f, duration);
+            sink = sink + static_cast<float>(SampleAnimation(animation, animation.start_time + time, nodes));
+        });
+    }
+
+    Run("hierarchy/UpdateJoints/" + input.name, scene.GetNodes().size(), [&]()
+    {
+        scene.UpdateJoints();
+        sink = sink + scene.GetMeshes().begin()->second.matrix.data[0].w;
+    });
+    if(num_joints > 0)
+    {
+        Run("palette/UpdatePalette/" + input.name, num_joints, [&]()
+        {
+            scene.UpdatePalette();
+            sink = sink + static_cast<float>(scene.GetPaletteTexels().size());
+        });
+    }
+
+    Run("scene/Update/" + input.name, 1, [&]()
+    {
+        scene.Update(1.0 / 60.0);
+    });
+    PoseSnapshot snapshot;
+    Run("scene/WriteSnapshot/" + input.name, scene.GetMeshes().size(), [&]()
+    {
+        scene.WriteSnapshot(snapshot);
+        sink = sink + static_cast<float>(snapshot.texels.size());
+    });
+}
+
+/* function to run the orca math kernels on fixed random data */
+void RunKernels()
+{
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    auto random_affine = [&]()
+    {
+        const orca::vec4<float> rotate = orca::Normalize(orca::vec4<float>(dist(random), dist(random), dist(random), dist(random)));
+        Pose single;
+        single.Resize(1);
+        single.parents[0] = -1;
+        single.SetJoint(0, orca::vec3<float>(dist(random), dist(random), dist(random)), rotate, orca::vec3<float>(1.0f, 1.0f, 1.0f));
+        orca::affine<float> matrix;
+        PoseToLocalMatrices(single, &matrix);
+        return matrix;
+    };
+
+    /* pose of 256 joints, each hanging off one of the 4 before it */
+    constexpr std::size_t num_pose_joints = 256;
+    Pose pose;
+    pose.Resize(num_pose_joints);
+    for(std::size_t i = 0; i < num_pose_joints; ++i)
+    {
+        pose.parents[i] = (i == 0) ? -1 : static_cast<int>(std::uniform_int_distribution<std::size_t>(i > 4 ? i - 4 : 0, i - 1)(random));
+        const orca::vec4<float> rotate = orca::Normalize(orca::vec4<float>(dist(random), dist(random), dist(random), dist(random)));
+        pose.SetJoint(i, orca::vec3<float>(dist(random), dist(random), dist(random)), rotate, orca::vec3<float>(1.0f, 1.0f, 1.0f));
+    }
+    std::vector<orca::affine<float>> worlds(num_pose_joints);
+    Run("orca/PoseToWorldMatrices/256", num_pose_joints, [&]()
+    {
+        PoseToWorldMatrices(pose, worlds.data());
+        sink = sink + worlds.back().data[0].w;
+    });
+
+    /* 4096 vertices with 4 weights on 64 joints */
+    constexpr std::size_t num_vertices = 4096;
+    constexpr std::size_t num_joints = 64;
+    std::vector<orca::affine<float>> joint_matrices(num_joints);
+    for(auto& matrix : joint_matrices)
+        matrix = random_affine();
+    std::vector<Vertex> vertices(num_vertices);
+    for(auto& vertex : vertices)
+    {
+        vertex.position = orca::vec3<float>(dist(random), dist(random), dist(random));
+        vertex.normal = orca::Normalize(orca::vec3<float>(dist(random), dist(random), dist(random)));
+        for(unsigned int k = 0; k < 4; ++k)
+        {
+            vertex.joint[k] = std::uniform_int_distribution<unsigned int>(0, num_joints - 1)(random);
+            vertex.weight[k] = 0.25f;
+        }
+    }
+    std::vector<orca::vec3<float>> positions(num_vertices);
+    std::vector<orca::vec3<float>> normals(num_vertices);
+    Run("orca/SkinVertices/4096", num_vertices, [&]()
+    {
+        SkinVertices(vertices.data(), num_vertices, joint_matrices.data(), positions.data(), normals.data());
+        sink = sink + positions.back().x;
+    });
+
+    /* joint matrix products and conversions as in Scene::UpdateNode() */
+    constexpr std::size_t num_matrices = 1024;
+    std::vector<orca::affine<float>> lhs(num_matrices);
+    std::vector<orca::affine<float>> rhs(num_matrices);
+    std::vector<orca::affine<float>> products(num_matrices);
+    std::vector<orca::dual_quaternion<float>> dual_quaternions(num_matrices);
+    for(std::size_t i = 0; i < num_matrices; ++i)
+    {
+        lhs[i] = random_affine();
+        rhs[i] = random_affine();
+    }
+    Run("orca/affine_multiply/1024", num_matrices, [&]()
+    {
+        for(std::size_t i = 0; i < num_matrices; ++i)
+            products[i] = lhs[i] * rhs[i];
+        sink = sink + products.back().data[0].w;
+    });
+    Run("orca/affine_inverse/1024", num_matrices, [&]()
+    {
+        for(std::size_t i = 0; i < num_matrices; ++i)
+            products[i] = orca::Inverse(lhs[i]);
+        sink = sink + products.back().data[0].w;
+    });
+    Run("orca/MakeDualQuaternion/1024", num_matrices, [&]()
+    {
+        for(std::size_t i = 0; i < num_matrices; ++i)
+            dual_quaternions[i] = orca::MakeDualQuaternion(lhs[i]);
+        sink = sink + dual_quaternions.back().real.r;
+    });
+}
+
+/* function to return the results and the build they ran on as JSON */
+nlohmann::json MakeReport()
+{
+#if defined(ORCA_SIMD_AVX2)
+    const char* simd = "AVX2";
+#elif defined(ORCA_SIMD_SSE2)
+    const char* simd = "SSE2";
+#else
+    const char* simd = "scalar";
+#endif
+#ifdef __OPTIMIZE__
+    const bool optimized = true;
+#else
+    const bool optimized = false;
+#endif
+
+    nlohmann::json report;
+    report["suite"] = "gltf_animation_core";
+    report["context"] = { { "simd", simd }, { "compiler", __VERSION__ }, { "optimized", optimized },
+                          { "samples", num_samples }, { "min_sample_ms", min_sample_ms },
+                          { "allocation_tracker", AllocationTracker::IsEnabled() } };
+    report["results"] = nlohmann::json::array();
+    for(const auto& result : results)
+    {
+        report["results"].push_back({ { "name", result.name }, { "items", result.items }, { "iterations", result.iterations },
+                                      { "samples", result.samples }, { "median_ns", result.median_ns }, { "min_ns", result.min_ns },
+                                      { "items_per_second", 1.0e9 * static_cast<double>(result.items) / result.median_ns },
+                                      { "allocations", result.allocations }, { "allocated_bytes", result.allocated_bytes },
+                                      { "measurements", result.measurements } });
+    }
+    return report;
+}
+
+/* function to read the medians of 'baseline_file' before the benchmarks run, returns false without it */
+bool LoadBaseline(const std::string& baseline_file, nlohmann::json& baseline)
+{
+    std::ifstream file(baseline_file);
+    if(file.is_open() == false)
+        return false;
+    baseline = nlohmann::json::parse(file);
+    for(const auto& entry : baseline["results"])
+        baseline_medians[entry.value("name", "")] = entry["median_ns"].get<double>();
+    return true;
+}
+
+/* function to compare the medians with those of 'baseline', returns the number of regressions */
+/* (benchmarks missing from the baseline are listed as new, those not run are skipped)        */
+std::size_t CompareBaseline(nlohmann::json& report, const nlohmann::json& baseline)
+{
+    if(baseline.find("context") != baseline.end())
+    {
+        if(baseline["context"].value("simd", "") != report["context"]["simd"])
+            std::printf("\nWARNING: the baseline was measured with %s kernels\n", baseline["context"].value("simd", "").c_str());
+        if(baseline["context"].value("optimized", true) != report["context"]["optimized"])
+            std::printf("\nWARNING: the baseline was measured with a build of another optimization level\n");
+    }
+
+    std::printf("\n%-52s %14s %14s %8s  (threshold %+.0f%%, confirmed %zu times)\n", "baseline comparison", "baseline", "current", "change",
+                threshold * 100.0, num_confirmations);
+    std::size_t regressions = 0;
+    for(auto& result : report["results"])
+    {
+        const std::string name = result["name"];
+        auto match = std::find_if(baseline["results"].begin(), baseline["results"].end(),
+                                  [&](const nlohmann::json& entry) { return entry.value("name", "") == name; });
+        if(match == baseline["results"].end())
+        {
+            std::printf("%-52s %14s %11.1f ns %8s  new\n", name.c_str(), "-", result["median_ns"].get<double>(), "");
+            continue;
+        }
+
+        const double baseline_ns = (*match)["median_ns"];
+        const double ratio = result["median_ns"].get<double>() / baseline_ns;
+        const char* status = "";
+        if(ratio > 1.0 + threshold)
+        {
+            status = "REGRESSION";
+            regressions += 1;
+        }
+        else if(ratio < 1.0 - threshold)
+            status = "faster";
+
+        result["baseline_median_ns"] = baseline_ns;
+        result["ratio"] = ratio;
+        std::printf("%-52s %11.1f ns %11.1f ns %+7.1f%%  %s\n", name.c_str(), baseline_ns, result["median_ns"].get<double>(), (ratio - 1.0) * 100.0, status);
+    }
+    report["threshold"] = threshold;
+    report["confirmations"] = num_confirmations;
+    report["regressions"] = regressions;
+    std::printf("%zu regression(s)\n", regressions);
+    return regressions;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::string usage = "usage: " + std::string(argv[0]) + " [--gltf <file>]... [--filter <text>] [--samples <count>] [--min-time <ms>]"
+                            + " [--output <json>] [--baseline <json>] [--threshold <ratio>] [--confirm <count>] [--expect-no-alloc]";
+    std::vector<std::string> files;
+    std::string output_file;
+    std::string baseline_file;
+    bool expect_no_alloc = false;
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if(arg == "--expect-no-alloc")
+            expect_no_alloc = true;
+        else if(i + 1 >= argc)
+        {
+            std::fprintf(stderr, "%s\n", usage.c_str());
+            return 2;
+        }
+        else if(arg == "--gltf")
+            files.push_back(argv[++i]);
+        else if(arg == "--filter")
+            filter = argv[++i];
+        else if(arg == "--samples")
+            num_samples = std::max<std::size_t>(std::stoul(argv[++i]), 1);
+        else if(arg == "--min-time")
+            min_sample_ms = std::max(std::stod(argv[++i]), 0.0);
+        else if(arg == "--output")
+            output_file = argv[++i];
+        else if(arg == "--baseline")
+            baseline_file = argv[++i];
+        else if(arg == "--threshold")
+            threshold = std::max(std::stod(argv[++i]), 0.0);
+        else if(arg == "--confirm")
+            num_confirmations = std::stoul(argv[++i]);
+        else
+        {
+            std::fprintf(stderr, "%s\n", usage.c_str());
+            return 2;
+        }
+    }
+
+    if(expect_no_alloc && AllocationTracker::IsEnabled() == false)
+    {
+        std::fprintf(stderr, "--expect-no-alloc needs a build with GLTF_ANIMATION_ALLOCATION_TRACKER\n");
+        return 2;
+    }
+
+    try
+    {
+        /* synthetic inputs of a small and a large character, written once as .glb */
+        std::vector<BenchInput> inputs;
+        SyntheticOptions small;
+        small.joints = 32;
+        small.vertices = 2048;
+        small.triangles = 2048;
+        small.keys = 30;
+        SyntheticOptions large;
+        large.joints = 256;
+        large.vertices = 32768;
+        large.triangles = 32768;
+        large.keys = 240;
+        const std::pair<const char*, SyntheticOptions> synthetic[] = { { "synthetic_small", small }, { "synthetic_large", large } };
+        for(const auto& entry : synthetic)
+        {
+            BenchInput input;
+            input.name = entry.first;
+            input.file = (std::filesystem::temp_directory_path() / ("bench_suite_" + input.name + ".glb")).string();
+            tinygltf::Model model = MakeSyntheticModel(entry.second);
+            WriteSyntheticModel(model, input.file);
+            LoadglTFModel(input.gltf_model, input.file);
+            inputs.push_back(std::move(input));
+        }
+        for(const auto& file : files)
+        {
+            BenchInput input;
+            input.name = std::filesystem::path(file).stem().string();
+            input.file = file;
+            LoadglTFModel(input.gltf_model, input.file);
+            inputs.push_back(std::move(input));
+        }
+
+        /* NOTE: read first, a benchmark over the threshold is measured again as it runs */
+        nlohmann::json baseline;
+        const bool has_baseline = (baseline_file.empty() == false) && LoadBaseline(baseline_file, baseline);
+        if(baseline_file.empty() == false && has_baseline == false)
+            std::printf("no baseline at '%s', nothing compared\n\n", baseline_file.c_str());
+
+        std::printf("%-52s %17s %17s %22s %10s %12s\n", "benchmark", "median", "min", "throughput", "allocs", "bytes");
+        for(auto& input : inputs)
+            RunInput(input);
+        RunKernels();
+
+        nlohmann::json report = MakeReport();
+        const std::size_t regressions = has_baseline ? CompareBaseline(report, baseline) : 0;
+        if(output_file.empty() == false)
+        {
+            std::ofstream file(output_file);
+            if(file.is_open() == false)
+                throw std::runtime_error("Failed to open '" + output_file + "'");
+            file << report.dump(2) << std::endl;
+            std::printf("results written to '%s'\n", output_file.c_str());
+        }
+
+        /* NOTE: the loader builds the model, the other benchmarks run what a frame runs */
+        std::size_t allocating = 0;
+        for(const auto& result : results)
+        {
+            if(expect_no_alloc == false || result.name.rfind("loader/", 0) == 0 || result.allocations == 0.0)
+                continue;
+            if(allocating++ == 0)
+                std::printf("\nbenchmarks of the steady state that allocate:\n");
+            std::printf("%-52s %10.4g allocations per call\n", result.name.c_str(), result.allocations);
+        }
+        return (regressions > 0 || allocating > 0) ? 1 : 0;
+    }
+    catch(const std::exception& e)
+    {
+        std::fprintf(stderr, "[ERROR] %s\n", e.what());
+        return 2;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+/***********************************/
+/*  FILE NAME: gltf_generator.cpp  */
+/***********************************/
+
+/**
+ * writes a synthetic skinned model (synthetic_gltf.h) as a .glb file, to feed the loader
+ * and animation benchmarks with inputs of controlled sizes. every option has the default
+ * of SyntheticOptions and the same options and seed always write the same file.
+ *
+ * usage: gltf_generator <output.glb> [--joints <count>] [--depth <count>] [--vertices <count>]
+ *                       [--triangles <count>] [--influences <1-4>] [--clips <count>] [--keys <count>]
+ *                       [--interpolation LINEAR|STEP|CUBICSPLINE] [--duration <seconds>]
+ *                       [--textures <count>] [--texture-size <pixels>] [--seed <value>]
+ * e.g. for a sweep over the joint count:
+ *   for j in 16 256 4096 65535; do gltf_generator joints_$j.glb --joints $j; done
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#include "synthetic_gltf.h"
+
+/* function to return the number of nodes of the longest chain from 'root_id' down */
+unsigned int ChainLength(const tinygltf::Model& model, int root_id)
+{
+    std::vector<std::pair<int, unsigned int>> stack = { { root_id, 1 } };
+    unsigned int length = 0;
+    while(stack.empty() == false)
+    {
+        const auto [node_id, level] = stack.back();
+        stack.pop_back();
+        length = std::max(length, level);
+        for(int child : model.nodes[node_id].children)
+            stack.emplace_back(child, level + 1);
+    }
+    return length;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::string usage = "usage: " + std::string(argv[0]) + " <output.glb> [--joints <count>] [--depth <count>] [--vertices <count>]"
+                            + " [--triangles <count>] [--influences <1-4>] [--clips <count>] [--keys <count>]"
+                            + " [--interpolation LINEAR|STEP|CUBICSPLINE] [--duration <seconds>]"
+                            + " [--textures <count>] [--texture-size <pixels>] [--seed <value>]";
+    /* -h or --help in place of the file or of an option name prints the usage */
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if((i == 1 || i % 2 == 0) && (arg == "-h" || arg == "--help"))
+        {
+            std::printf("%s\n", usage.c_str());
+            return 0;
+        }
+    }
+    if(argc < 2 || argc % 2 != 0)
+    {
+        std::fprintf(stderr, "%s\n", usage.c_str());
+        return 2;
+    }
+    if(argv[1][0] == '-')
+    {
+        std::fprintf(stderr, "unknown option '%s'\n%s\n", argv[1], usage.c_str());
+        return 2;
+    }
+
+    try
+    {
+        const std::string file = argv[1];
+        SyntheticOptions options;
+        for(int i = 2; i < argc; i += 2)
+        {
+            const std::string arg = argv[i];
+            const std::string value = argv[i + 1];
+            if(arg == "--joints")
+                options.joints = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--depth")
+                options.depth = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--vertices")
+                options.vertices = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--triangles")
+                options.triangles = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--influences")
+                options.influences = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--clips")
+                options.clips = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--keys")
+                options.keys = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--interpolation")
+                options.interpolation = value;
+            else if(arg == "--duration")
+                options.duration = std::stof(value);
+            else if(arg == "--textures")
+                options.textures = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--texture-size")
+                options.texture_size = static_cast<unsigned int>(std::stoul(value));
+            else if(arg == "--seed")
+                options.seed = static_cast<std::uint32_t>(std::stoul(value));
+            else
+            {
+                std::fprintf(stderr, "unknown option '%s'\n%s\n", arg.c_str(), usage.c_str());
+                return 2;
+            }
+        }
+
+        /* JOINTS_0 is read as unsigned short, and only 4 weights are read per vertex */
+        if(options.joints > 65535)
+            throw std::runtime_error("At most 65535 joints can be skinned");
+        if(options.influences < 1 || options.influences > 4)
+            throw std::runtime_error("A vertex has 1 to 4 influences");
+
+        const auto start = std::chrono::steady_clock::now();
+        tinygltf::Model model = MakeSyntheticModel(options);
+        WriteSyntheticModel(model, file);
+        const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%s: %u joints (depth %u), %u vertices, %u triangles, %u influences,"
+                    " %u clips of %u %s keys, %u textures of %upx, seed %u\n",
+                    file.c_str(), options.joints, ChainLength(model, 0) - 1, options.vertices, options.triangles, options.influences,
+                    options.clips, options.keys, options.interpolation.c_str(), options.textures, options.texture_size, options.seed);
+        std::printf("%ju bytes written in %.1f ms\n", static_cast<std::uintmax_t>(std::filesystem::file_size(file)), elapsed);
+        return 0;
+    }
+    catch(const std::exception& e)
+    {
+        std::fprintf(stderr, "[ERROR] %s\n", e.what());
+        return 1;
+    }
+}
\ No newline at end of file
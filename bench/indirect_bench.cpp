@@ -0,0 +1,114 @@
+/***********************************/
+/*  FILE NAME: indirect_bench.cpp  */
+/***********************************/
+
+/**
+ * CPU cost of submitting a scene of thousands of meshes per frame: frustum
+ * culling with the mesh bounds, then building the indirect commands, the
+ * per-draw parameters and the texture batches (IndirectDrawList). the GL calls
+ * each path would issue are counted: one draw per mesh plus its binds for the
+ * per-mesh path (RenderQueue), one multi-draw per texture for the indirect path.
+ * 
+ * usage: indirect_bench [textures] [rounds]
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <algorithm>
+
+#include <vector.hpp>
+#include <matrix.hpp>
+#include "Camera/camera.h"
+#include "Model/bounds.h"
+#include "Model/indirect_draw.h"
+
+/* mesh of the synthetic scene */
+struct SceneMesh
+{
+    BoundingBox bounds;
+    BoundingSphere sphere;
+    unsigned int texture;
+    unsigned int first_vertex;
+    unsigned int vertex_count;
+    int material_id;
+};
+
+/* returns the time of 'op' in microseconds, best of 'rounds' */
+template<typename Op>
+double Measure(std::size_t rounds, Op op)
+{
+    double best = 1e30;
+    for(std::size_t round = 0; round < rounds; ++round)
+    {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[])
+{
+    const unsigned int num_textures = (argc > 1) ? std::stoul(argv[1]) : 8;
+    const std::size_t num_rounds = (argc > 2) ? std::stoul(argv[2]) : 50;
+
+    Camera camera;
+    const Frustum frustum = MakeFrustum(camera.getViewMatrix() * camera.getProjectionMatrix(1280, 720));
+
+    std::printf("textures: %u\n", num_textures);
+    std::printf("%8s %8s %14s %12s %16s %16s\n", "meshes", "visible", "cull+build us", "ns/mesh", "GL calls (mesh)", "GL calls (MDI)");
+    for(std::size_t num_meshes = 1000; num_meshes <= 32000; num_meshes *= 2)
+    {
+        /* meshes spread in front of and around the camera, about half are visible */
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        std::uniform_real_distribution<float> size(0.2f, 2.0f);
+        std::vector<SceneMesh> scene(num_meshes);
+        unsigned int first_vertex = 0;
+        for(auto& mesh : scene)
+        {
+            const orca::vec3<float> center(position(random), position(random) * 0.25f, position(random) + 60.0f);
+            const orca::vec3<float> extents(size(random), size(random), size(random));
+            mesh.bounds.Extend(center - extents);
+            mesh.bounds.Extend(center + extents);
+            mesh.sphere = MakeBoundingSphere(mesh.bounds);
+            mesh.texture = 1 + static_cast<unsigned int>(random() % num_textures);
+            mesh.material_id = static_cast<int>(mesh.texture - 1);
+            mesh.vertex_count = 300 + static_cast<unsigned int>(random() % 3000);
+            mesh.first_vertex = first_vertex;
+            first_vertex += mesh.vertex_count;
+        }
+
+        IndirectDrawList list;
+        FrameArena arena;
+        std::size_t visible = 0;
+        const double us = Measure(num_rounds, [&]()
+        {
+            arena.Reset();
+            list.Clear();
+            for(std::size_t i = 0; i < scene.size(); ++i)
+            {
+                const SceneMesh& mesh = scene[i];
+                if(IsVisible(frustum, mesh.sphere) == false || IsVisible(frustum, mesh.bounds) == false)
+                    continue;
+                list.Push(mesh.texture, mesh.first_vertex, mesh.vertex_count, static_cast<int>(i) * 3, mesh.material_id);
+            }
+            list.Build(arena);
+            visible = list.Size();
+        });
+
+        /* per-mesh path: a draw and a joint offset uniform per mesh, a texture bind per texture change */
+        const std::size_t mesh_calls = visible * 2 + list.GetBatches().size();
+        /* indirect path: a texture bind and a multi-draw per batch, plus the parameter pointer */
+        const std::size_t mdi_calls = list.GetBatches().size() * 2 + 1;
+        std::printf("%8zu %8zu %14.1f %12.1f %16zu %16zu\n", num_meshes, visible, us, us * 1000.0 / num_meshes, mesh_calls, mdi_calls);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+/******************************/
+/*  FILE NAME: mip_bench.cpp  */
+/******************************/
+
+/**
+ * Time to build the mip chain of an RGBA image on one worker thread
+ * (MipChain::Build), with the gamma-correct filter of color textures and the
+ * plain one of data textures. this is the work taken off the main thread; the
+ * main thread only streams the levels, a budget of rows per frame.
+ * 
+ * usage: mip_bench [rounds]
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdio>
+#include <algorithm>
+
+#include "Model/image.h"
+#include "Model/mip_chain.h"
+
+/* returns the time of 'op' in milliseconds, best of 'rounds' */
+template<typename Op>
+double Measure(std::size_t rounds, Op op)
+{
+    double best = 1e30;
+    for(std::size_t round = 0; round < rounds; ++round)
+    {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t num_rounds = (argc > 1) ? std::stoul(argv[1]) : 3;
+
+    /* a black and white checker averages to 50% light: 188 in sRGB, 128 as stored */
+    Image checker;
+    checker.width = 2;
+    checker.height = 2;
+    checker.component = 4;
+    checker.data = { 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 255 };
+    MipChain checker_chain;
+    checker_chain.Build(checker, true);
+    const int srgb_value = checker_chain.Data(1)[0];
+    checker_chain.Build(checker, false);
+    std::printf("checker 1x1 level: %d (sRGB), %d (data)\n\n", srgb_value, checker_chain.Data(1)[0]);
+
+    std::printf("%6s %7s %14s %14s %12s\n", "size", "levels", "sRGB ms", "data ms", "mip MiB");
+    for(int size = 512; size <= 4096; size *= 2)
+    {
+        std::mt19937 random(1234);
+        Image image;
+        image.width = size;
+        image.height = size;
+        image.component = 4;
+        image.data.resize(static_cast<std::size_t>(size) * size * 4);
+        for(auto& value : image.data)
+            value = static_cast<unsigned char>(random());
+
+        MipChain chain;
+        const double srgb_ms = Measure(num_rounds, [&]() { chain.Build(image, true); });
+        const double data_ms = Measure(num_rounds, [&]() { chain.Build(image, false); });
+
+        std::size_t mip_bytes = 0;
+        for(int level = 1; level < chain.NumLevels(); ++level)
+            mip_bytes += chain.RowBytes(level) * chain.Height(level);
+        std::printf("%6d %7d %14.2f %14.2f %12.2f\n", size, chain.NumLevels(), srgb_ms, data_ms, mip_bytes / (1024.0 * 1024.0));
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*******************************/
+/*  FILE NAME: move_check.cpp  */
+/*******************************/
+
+/**
+ * Check of the move assignment of Mesh and Texture over objects that own GL
+ * objects, in a headless context: the assigned object takes the vertex array
+ * (or texture) of the right hand side, the right hand side is left with the
+ * old one, and cleaning up both deletes both without touching the other.
+ * prints every failed check and exits with 1 if there is one.
+ *
+ * usage: move_check
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstdio>
+#include <utility>
+#include <exception>
+#include <GL/glew.h>
+
+#include "Model/mesh.h"
+#include "Model/texture.h"
+#include "Renderer/gl_state.h"
+#include "Renderer/headless_context.h"
+
+int failures = 0;
+
+/* prints 'what' if 'passed' is false */
+void Check(bool passed, const char* what)
+{
+    if(passed == false)
+    {
+        std::printf("FAILED: %s\n", what);
+        failures += 1;
+    }
+}
+
+/* returns a mesh of one triangle set up in 'vertex_buffer' */
+Mesh MakeMesh(const char* name, unsigned int vertex_buffer)
+{
+    Mesh mesh;
+    mesh.name = name;
+    mesh.vertices.resize(3);
+    mesh.indices = { 0, 1, 2 };
+    mesh.SetupMesh(vertex_buffer);
+    return mesh;
+}
+
+/* returns a texture of a 'size' x 'size' RGBA image set up in OpenGL */
+Texture MakeTexture(const char* name, int size)
+{
+    Texture texture;
+    texture.name = name;
+    texture.image.width = size;
+    texture.image.height = size;
+    texture.image.component = 4;
+    texture.image.data.assign(static_cast<std::size_t>(size * size * 4), 255);
+    texture.sampler.min_filter = FILTER_MODE::LINEAR_MIPMAP_LINEAR;
+    texture.sampler.mag_filter = FILTER_MODE::LINEAR;
+    texture.sampler.wrap_R = WRAP_MODE::REPEAT;
+    texture.sampler.wrap_S = WRAP_MODE::REPEAT;
+    texture.sampler.wrap_T = WRAP_MODE::REPEAT;
+    texture.SetupTexture();
+    return texture;
+}
+
+void CheckMesh(unsigned int vertex_buffer)
+{
+    Mesh target = MakeMesh("target", vertex_buffer);
+    Mesh source = MakeMesh("source", vertex_buffer);
+    const unsigned int target_vao = target.GetVertexArray();
+    const unsigned int source_vao = source.GetVertexArray();
+    Check(target_vao != 0 && source_vao != 0 && target_vao != source_vao, "mesh: two vertex arrays set up");
+
+    target = std::move(source);
+    Check(target.name == "source", "mesh: the data is moved");
+    Check(target.indices.size() == 3 && source.indices.empty() == true, "mesh: the indices are moved");
+    Check(target.GetVertexArray() == source_vao, "mesh: the vertex array is taken from the right hand side");
+    Check(source.GetVertexArray() == target_vao, "mesh: the old vertex array is left to the right hand side");
+
+    source.CleanupMesh();
+    Check(glIsVertexArray(target_vao) == GL_FALSE, "mesh: the old vertex array is deleted by the right hand side");
+    Check(glIsVertexArray(source_vao) == GL_TRUE, "mesh: the vertex array assigned is still alive");
+
+    Mesh& same = target;
+    target = std::move(same);
+    Check(target.GetVertexArray() == source_vao && target.indices.size() == 3, "mesh: self assignment keeps the mesh");
+
+    target.CleanupMesh();
+    Check(glIsVertexArray(source_vao) == GL_FALSE, "mesh: the vertex array assigned is deleted");
+}
+
+void CheckTexture()
+{
+    Texture target = MakeTexture("target", 4);
+    Texture source = MakeTexture("source", 8);
+    const unsigned int target_texture = target.GetTexture();
+    const unsigned int source_texture = source.GetTexture();
+    Check(target_texture != 0 && source_texture != 0 && target_texture != source_texture, "texture: two textures set up");
+
+    target.mip_chain.Build(target.image, false);
+    source.mip_chain.Build(source.image, false);
+    target = std::move(source);
+    Check(target.name == "source" && target.image.width == 8, "texture: the image is moved");
+    Check(target.NumLevels() == 4 && source.NumLevels() == 3, "texture: the levels follow the textures");
+    Check(target.mip_chain.NumLevels() == 0 && source.mip_chain.NumLevels() == 0, "texture: no mip chain is kept");
+    Check(target.GetTexture() == source_texture, "texture: the texture is taken from the right hand side");
+    Check(source.GetTexture() == target_texture, "texture: the old texture is left to the right hand side");
+
+    source.CleanupTexture();
+    Check(glIsTexture(target_texture) == GL_FALSE, "texture: the old texture is deleted by the right hand side");
+    Check(glIsTexture(source_texture) == GL_TRUE, "texture: the texture assigned is still alive");
+
+    target.CleanupTexture();
+    Check(glIsTexture(source_texture) == GL_FALSE, "texture: the texture assigned is deleted");
+}
+
+int main()
+{
+    try
+    {
+        HeadlessContext context;
+        context.SetupContext(3, 3);
+
+        /* NOTE: GLEW built for GLX fails to find a GLX display after loading the core entry points */
+        glewExperimental = GL_TRUE;
+        const GLenum result = glewInit();
+        if(result != GLEW_OK && result != GLEW_ERROR_NO_GLX_DISPLAY)
+        {
+            std::printf("Failed to initialize GLEW.\n");
+            return 1;
+        }
+
+        unsigned int vertex_buffer = 0;
+        glGenBuffers(1, &vertex_buffer);
+        GLState::Get().BindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * 6, nullptr, GL_STATIC_DRAW);
+
+        CheckMesh(vertex_buffer);
+        CheckTexture();
+
+        GLState::Get().DeleteBuffer(vertex_buffer);
+        Check(glGetError() == GL_NO_ERROR, "no GL error");
+    }
+    catch(const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        return 1;
+    }
+
+    if(failures == 0)
+        std::printf("move_check: passed\n");
+    return (failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+/********************************/
+/*  FILE NAME: orca_bench.cpp  */
+/********************************/
+
+/**
+ * Microbenchmark of the orca float kernels used by the animation code
+ * (Node::LocalMatrix, Model::GetNodeMatrix and the joint palette).
+ * 
+ * every operation prints the time per call and a checksum of its results.
+ * build it once normally and once with ORCA_NO_SIMD to compare the SIMD
+ * specializations against the scalar code: the checksums must match.
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+
+#include <vector.hpp>
+#include <vector_functions.hpp>
+#include <matrix.hpp>
+#include <matrix_functions.hpp>
+#include <quaternion.hpp>
+#include <quaternion_functions.hpp>
+#include <affine_functions.hpp>
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+constexpr std::size_t NUM_INPUTS = 1024;
+constexpr std::size_t NUM_ROUNDS = 2000;
+
+/*************/
+/*  GLOBALS  */
+/*************/
+std::vector<orca::mat4<float>> matrices;
+std::vector<orca::vec4<float>> vectors;
+std::vector<orca::vec4<float>> rotations;
+
+/* folds the bit pattern of a float array into a checksum */
+std::uint32_t Checksum(const std::vector<float>& data)
+{
+    std::uint32_t checksum = 2166136261U;
+    for(float value : data)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        checksum = (checksum ^ bits) * 16777619U;
+    }
+    return checksum;
+}
+
+/* runs 'op(i)' over all inputs, prints the time per call and the checksum of the results */
+template<typename Result, typename Op>
+void Run(const char* name, Op op)
+{
+    std::vector<Result> results(NUM_INPUTS);
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t round = 0; round < NUM_ROUNDS; ++round)
+        for(std::size_t i = 0; i < NUM_INPUTS; ++i)
+            results[(i + round) % NUM_INPUTS] = op(i);
+    auto end = std::chrono::steady_clock::now();
+
+    std::vector<float> values;
+    for(const auto& result : results)
+        values.insert(values.end(), static_cast<const float*>(result), static_cast<const float*>(result) + sizeof(Result) / sizeof(float));
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(NUM_ROUNDS * NUM_INPUTS);
+    std::printf("%-24s %9.2f ns/op   checksum %08x\n", name, ns, Checksum(values));
+}
+
+int main()
+{
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    for(std::size_t i = 0; i < NUM_INPUTS; ++i)
+    {
+        orca::mat4<float> mat;
+        for(unsigned int r = 0; r < mat.RowSize(); ++r)
+            for(unsigned int c = 0; c < mat.ColSize(); ++c)
+                mat[r][c] = dist(random);
+        matrices.push_back(mat);
+        vectors.emplace_back(dist(random), dist(random), dist(random), dist(random));
+        rotations.push_back(orca::Normalize(orca::vec4<float>(dist(random), dist(random), dist(random), dist(random))));
+    }
+
+#if defined(ORCA_SIMD_AVX2)
+    std::printf("orca kernels: AVX2\n");
+#elif defined(ORCA_SIMD_SSE2)
+    std::printf("orca kernels: SSE2\n");
+#else
+    std::printf("orca kernels: scalar\n");
+#endif
+
+    Run<orca::mat4<float>>("mat4 * mat4", [](std::size_t i)
+    {
+        return matrices[i] * matrices[(i + 1) % NUM_INPUTS];
+    });
+
+    Run<orca::affine<float>>("affine * affine", [](std::size_t i)
+    {
+        return orca::MakeAffine(matrices[i]) * orca::MakeAffine(matrices[(i + 1) % NUM_INPUTS]);
+    });
+
+    Run<orca::vec4<float>>("vec4 * mat4", [](std::size_t i)
+    {
+        return vectors[i] * matrices[i];
+    });
+
+    Run<orca::mat4<float>>("QuaternionToMatrix", [](std::size_t i)
+    {
+        return orca::QuaternionToMatrix(orca::quaternion<float>(rotations[i]));
+    });
+
+    Run<orca::vec4<float>>("Normalize(vec4)", [](std::size_t i)
+    {
+        return orca::Normalize(vectors[i]);
+    });
+
+    Run<orca::vec4<float>>("Slerp(vec4)", [](std::size_t i)
+    {
+        return orca::Slerp(rotations[i], rotations[(i + 1) % NUM_INPUTS], 0.25f);
+    });
+
+    Run<orca::mat4<float>>("S * R * T (LocalMatrix)", [](std::size_t i)
+    {
+        orca::vec3<float> scale(vectors[i]);
+        orca::vec3<float> translate(vectors[(i + 1) % NUM_INPUTS]);
+        return orca::Scale(scale) * orca::QuaternionToMatrix(orca::quaternion<float>(rotations[i])) * orca::Translate(translate);
+    });
+
+    Run<orca::affine<float>>("MakeAffine(S, R, T)", [](std::size_t i)
+    {
+        orca::vec3<float> scale(vectors[i]);
+        orca::vec3<float> translate(vectors[(i + 1) % NUM_INPUTS]);
+        return orca::MakeAffine(scale, orca::quaternion<float>(rotations[i]), translate);
+    });
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+/***********************************/
+/*  FILE NAME: pipeline_bench.cpp  */
+/***********************************/
+
+/**
+ * Throughput and latency of the serial frame loop (update, then render) against
+ * the pipelined one of '--pipelined', where an update thread writes the next
+ * pose snapshot while the render thread draws the previous one (PoseExchange).
+ * the update and the render are stood in for by a fixed amount of arithmetic,
+ * calibrated to the given times on one thread, and the update copies a joint
+ * palette of the given size into its snapshot. the pipelined loop can only be
+ * faster with a free core for the update thread.
+ * 
+ * usage: pipeline_bench [update us] [render us] [frames] [texels]
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <algorithm>
+#include <condition_variable>
+
+#include <vector.hpp>
+#include "Model/pose_snapshot.h"
+#include "Renderer/frame_times.h"
+
+/* function to return the time of the steady clock in seconds */
+double CurrentTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* iterations of Work() per microsecond, set by Calibrate() */
+static double iterations_per_us = 100.0;
+
+/* function to run 'microseconds' of arithmetic (as calibrated, not as measured) */
+float Work(double microseconds)
+{
+    const std::size_t iterations = static_cast<std::size_t>(microseconds * iterations_per_us);
+    volatile float sink = 0.0f;
+    float value = 1.0f;
+    for(std::size_t i = 0; i < iterations; ++i)
+        value = value * 0.999999f + 0.5f;
+    sink = value;
+    return sink;
+}
+
+/* function to measure the iterations of Work() per microsecond */
+void Calibrate()
+{
+    iterations_per_us = 1000.0;
+    double best = 1e30;
+    for(int round = 0; round < 5; ++round)
+    {
+        const double start_time = CurrentTime();
+        Work(10000.0);
+        best = std::min(best, CurrentTime() - start_time);
+    }
+    iterations_per_us = 1000.0 * 10000.0 / (best * 1e6);
+}
+
+/* function to stand in for Model::Update() and Model::WriteSnapshot() */
+void Update(PoseExchange& exchange, const std::vector<orca::vec4<float>>& palette, double update_us)
+{
+    PoseSnapshot& pose = exchange.Back();
+    pose.update_start = CurrentTime();
+    Work(update_us);
+    pose.texels.assign(palette.begin(), palette.end());
+    pose.update_time = (CurrentTime() - pose.update_start) * 1000.0;
+    exchange.Publish();
+}
+
+/* function to run 'frames' frames and print their statistics */
+void Run(bool pipelined, double update_us, double render_us, std::size_t frames, const std::vector<orca::vec4<float>>& palette)
+{
+    PoseExchange exchange;
+    FrameTimes frame_times;
+    frame_times.Reserve(frames);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool running = true;
+    bool requested = true;
+    std::thread update_thread;
+
+    Update(exchange, palette, update_us);
+    if(pipelined == true)
+    {
+        update_thread = std::thread([&]()
+        {
+            while(true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    condition.wait(lock, [&]() { return requested || !running; });
+                    if(running == false)
+                        return;
+                    requested = false;
+                }
+                Update(exchange, palette, update_us);
+            }
+        });
+    }
+
+    const double start_time = CurrentTime();
+    for(std::size_t frame = 0; frame < frames; ++frame)
+    {
+        if(pipelined == false)
+            Update(exchange, palette, update_us);
+
+        const double render_time = CurrentTime();
+        const PoseSnapshot& pose = exchange.Acquire();
+        if(pipelined == true)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                requested = true;
+            }
+            condition.notify_one();
+        }
+        Work(render_us);
+        const double end_time = CurrentTime();
+        frame_times.Add(pose.update_time, (end_time - render_time) * 1000.0, (end_time - pose.update_start) * 1000.0);
+    }
+    const double elapsed_time = CurrentTime() - start_time;
+
+    if(pipelined == true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        condition.notify_one();
+        update_thread.join();
+    }
+
+    std::printf("[%s] %.1f fps, %llu poses published, %llu frames drew the previous pose\n", pipelined ? "pipelined" : "serial",
+                static_cast<double>(frames) / elapsed_time, exchange.Published(), exchange.Reused());
+    std::printf("%s\n", frame_times.Report().c_str());
+}
+
+int main(int argc, char* argv[])
+{
+    const double update_us = (argc > 1) ? std::stod(argv[1]) : 4000.0;
+    const double render_us = (argc > 2) ? std::stod(argv[2]) : 6000.0;
+    const std::size_t frames = (argc > 3) ? std::stoul(argv[3]) : 300;
+    const std::size_t texels = (argc > 4) ? std::stoul(argv[4]) : 64 * 1024;
+
+    const std::vector<orca::vec4<float>> palette(texels, orca::vec4<float>(1.0f, 0.0f, 0.0f, 0.0f));
+    Calibrate();
+    std::printf("update: %.0f us, render: %.0f us, frames: %zu, palette: %zu texels, cores: %u\n\n",
+                update_us, render_us, frames, texels, std::thread::hardware_concurrency());
+    Run(false, update_us, render_us, frames, palette);
+    Run(true, update_us, render_us, frames, palette);
+    return 0;
+}
\ No newline at end of file
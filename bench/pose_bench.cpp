@@ -0,0 +1,114 @@
+/*******************************/
+/*  FILE NAME: pose_bench.cpp  */
+/*******************************/
+
+/**
+ * Throughput of the batched local pose to matrix kernel (PoseToWorldMatrices)
+ * against the per-node path it replaces: Node::LocalMatrix() built from four
+ * mat4 and concatenated up to the root for every node (Model::GetNodeMatrix).
+ * 
+ * usage: pose_bench [joints] [rounds]
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <algorithm>
+
+#include <vector.hpp>
+#include <matrix.hpp>
+#include <matrix_functions.hpp>
+#include <affine_functions.hpp>
+#include <quaternion_functions.hpp>
+#include "Model/pose.h"
+
+/* local matrix of a joint as the original Node::LocalMatrix() built it */
+orca::mat4<float> LocalMatrix(const Pose& pose, std::size_t i)
+{
+    orca::vec3<float> translate(pose.translate_x[i], pose.translate_y[i], pose.translate_z[i]);
+    orca::vec4<float> rotate(pose.rotate_x[i], pose.rotate_y[i], pose.rotate_z[i], pose.rotate_w[i]);
+    orca::vec3<float> scale(pose.scale_x[i], pose.scale_y[i], pose.scale_z[i]);
+    orca::mat4<float> matrix;
+    matrix = orca::Identity(matrix);
+    return matrix * orca::Scale(scale) * orca::QuaternionToMatrix(orca::quaternion<float>(rotate)) * orca::Translate(translate);
+}
+
+/* returns the time of 'op' in microseconds, best of 'rounds' */
+template<typename Op>
+double Measure(std::size_t rounds, Op op)
+{
+    double best = 1e30;
+    for(std::size_t round = 0; round < rounds; ++round)
+    {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t num_joints = (argc > 1) ? std::stoul(argv[1]) : 256;
+    const std::size_t num_rounds = (argc > 2) ? std::stoul(argv[2]) : 200;
+
+    /* random skeleton, parents always come before their children */
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale_dist(0.5f, 1.5f);
+    Pose pose;
+    pose.Resize(num_joints);
+    for(std::size_t i = 0; i < num_joints; ++i)
+    {
+        pose.parents[i] = (i == 0) ? -1 : static_cast<int>(std::uniform_int_distribution<std::size_t>(i > 4 ? i - 4 : 0, i - 1)(random));
+        orca::vec4<float> rotate = orca::Normalize(orca::vec4<float>(dist(random), dist(random), dist(random), dist(random)));
+        pose.SetJoint(i, orca::vec3<float>(dist(random), dist(random), dist(random)), rotate, orca::vec3<float>(scale_dist(random), scale_dist(random), scale_dist(random)));
+    }
+
+    std::vector<orca::mat4<float>> reference(num_joints);
+    std::vector<orca::affine<float>> worlds(num_joints);
+    std::vector<orca::affine<float>> locals(num_joints);
+
+    double per_node_us = Measure(num_rounds, [&]()
+    {
+        for(std::size_t i = 0; i < num_joints; ++i)
+        {
+            auto matrix = LocalMatrix(pose, i);
+            for(int id = pose.parents[i]; id != -1; id = pose.parents[id])
+                matrix = matrix * LocalMatrix(pose, id);
+            reference[i] = matrix;
+        }
+    });
+
+    double local_us = Measure(num_rounds, [&]() { PoseToLocalMatrices(pose, locals.data()); });
+    double world_us = Measure(num_rounds, [&]() { PoseToWorldMatrices(pose, worlds.data()); });
+
+    float max_error = 0.0f;
+    for(std::size_t i = 0; i < num_joints; ++i)
+    {
+        const orca::mat4<float> world = orca::MakeMatrix4X4(worlds[i]);
+        for(unsigned int r = 0; r < 4; ++r)
+            for(unsigned int c = 0; c < 4; ++c)
+                max_error = std::max(max_error, std::abs(world[r][c] - reference[i][r][c]) / std::max(1.0f, std::abs(reference[i][r][c])));
+    }
+
+#if defined(ORCA_SIMD_AVX2)
+    const char* kernel = "AVX2, 8 joints per iteration";
+#elif defined(ORCA_SIMD_SSE2)
+    const char* kernel = "SSE2, 4 joints per iteration";
+#else
+    const char* kernel = "scalar";
+#endif
+    std::printf("joints: %zu, kernel: %s\n", num_joints, kernel);
+    std::printf("%-28s %10.2f joints/us\n", "per node mat4 (original)", num_joints / per_node_us);
+    std::printf("%-28s %10.2f joints/us\n", "PoseToLocalMatrices", num_joints / local_us);
+    std::printf("%-28s %10.2f joints/us\n", "PoseToWorldMatrices", num_joints / world_us);
+    std::printf("max relative error: %g\n", max_error);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+/***********************************/
+/*  FILE NAME: skinning_bench.cpp  */
+/***********************************/
+
+/**
+ * Throughput of the CPU skinning engine (CpuSkinning) per thread count on a
+ * synthetic mesh, and its largest difference to the GLSL/anim_vert.glsl
+ * formula evaluated in double precision.
+ * 
+ * build it once normally and once with ORCA_NO_SIMD to compare the SIMD
+ * kernels against the scalar code.
+ * 
+ * usage: skinning_bench [vertices] [max threads] [rounds]
+ */
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <thread>
+#include <algorithm>
+
+#include <vector.hpp>
+#include <vector_functions.hpp>
+#include <matrix.hpp>
+#include <affine_functions.hpp>
+#include <quaternion.hpp>
+#include "Model/vertex.h"
+#include "Model/skinning.h"
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+constexpr unsigned int NUM_JOINTS = 64;
+
+/* skin a vertex like GLSL/anim_vert.glsl, in double precision */
+void ReferenceSkin(const Vertex& vertex, const std::vector<orca::affine<float>>& joint_matrices, double* position, double* normal)
+{
+    double skin[3][4] = {};
+    for(unsigned int k = 0; k < 4; ++k)
+    {
+        const orca::affine<float>& joint = joint_matrices[vertex.joint[k]];
+        for(unsigned int r = 0; r < 3; ++r)
+            for(unsigned int c = 0; c < 4; ++c)
+                skin[r][c] += static_cast<double>(joint.data[r].data[c]) * vertex.weight[k];
+    }
+
+    double length = 0.0;
+    for(unsigned int r = 0; r < 3; ++r)
+    {
+        position[r] = skin[r][0] * vertex.position.x + skin[r][1] * vertex.position.y + skin[r][2] * vertex.position.z + skin[r][3];
+        normal[r] = skin[r][0] * vertex.normal.x + skin[r][1] * vertex.normal.y + skin[r][2] * vertex.normal.z;
+        length += normal[r] * normal[r];
+    }
+    for(unsigned int r = 0; r < 3; ++r)
+        normal[r] /= std::sqrt(length);
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t num_vertices = (argc > 1) ? std::stoul(argv[1]) : 200000;
+    const unsigned int max_threads = (argc > 2) ? static_cast<unsigned int>(std::stoul(argv[2])) : std::max(1U, std::thread::hardware_concurrency());
+    const std::size_t num_rounds = (argc > 3) ? std::stoul(argv[3]) : 20;
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale_dist(0.8f, 1.2f);
+    std::uniform_int_distribution<unsigned int> joint_dist(0, NUM_JOINTS - 1);
+
+    std::vector<orca::affine<float>> joint_matrices(NUM_JOINTS);
+    for(auto& joint_matrix : joint_matrices)
+    {
+        const orca::vec4<float> rotate = orca::Normalize(orca::vec4<float>(dist(random), dist(random), dist(random), dist(random)));
+        joint_matrix = orca::MakeAffine(orca::vec3<float>(scale_dist(random), scale_dist(random), scale_dist(random)), orca::quaternion<float>(rotate), orca::vec3<float>(dist(random), dist(random), dist(random)));
+    }
+
+    /* one to four influences per vertex, weights add up to one */
+    std::vector<Vertex> vertices(num_vertices);
+    for(auto& vertex : vertices)
+    {
+        vertex.position = orca::vec3<float>(dist(random), dist(random), dist(random)) * 10.0f;
+        vertex.normal = orca::Normalize(orca::vec3<float>(dist(random), dist(random), dist(random)));
+        const unsigned int num_influences = 1 + joint_dist(random) % 4;
+        float total = 0.0f;
+        for(unsigned int k = 0; k < 4; ++k)
+        {
+            vertex.joint[k] = joint_dist(random);
+            vertex.weight[k] = (k < num_influences) ? (dist(random) + 1.5f) : 0.0f;
+            total += vertex.weight[k];
+        }
+        vertex.weight = vertex.weight / total;
+    }
+
+    std::vector<orca::vec3<float>> positions;
+    std::vector<orca::vec3<float>> normals;
+
+#if defined(ORCA_SIMD_AVX2)
+    const char* kernel = "AVX2, 8 vertices per iteration";
+#elif defined(ORCA_SIMD_SSE2)
+    const char* kernel = "SSE2, 4 vertices per iteration";
+#else
+    const char* kernel = "scalar";
+#endif
+    std::printf("vertices: %zu, joints: %u, kernel: %s, hardware threads: %u\n", num_vertices, NUM_JOINTS, kernel, std::thread::hardware_concurrency());
+
+    double single_thread = 0.0;
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads = (num_threads * 2 > max_threads && num_threads != max_threads) ? max_threads : num_threads * 2)
+    {
+        CpuSkinning skinning(num_threads);
+        double best = 1e30;
+        for(std::size_t round = 0; round < num_rounds; ++round)
+        {
+            auto start = std::chrono::steady_clock::now();
+            skinning.Skin(vertices, joint_matrices.data(), positions, normals);
+            auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(end - start).count());
+        }
+
+        const double vertices_per_second = num_vertices / best;
+        if(num_threads == 1)
+            single_thread = vertices_per_second;
+        std::printf("threads %3u   %9.2f Mvertices/s   x%.2f\n", num_threads, vertices_per_second / 1.0e6, vertices_per_second / single_thread);
+    }
+
+    double max_position_error = 0.0;
+    double max_normal_error = 0.0;
+    for(std::size_t i = 0; i < num_vertices; ++i)
+    {
+        double position[3];
+        double normal[3];
+        ReferenceSkin(vertices[i], joint_matrices, position, normal);
+        for(unsigned int r = 0; r < 3; ++r)
+        {
+            max_position_error = std::max(max_position_error, std::abs(position[r] - positions[i][r]));
+            max_normal_error = std::max(max_normal_error, std::abs(normal[r] - normals[i][r]));
+        }
+    }
+    std::printf("max error against the shader formula: position %g, normal %g\n", max_position_error, max_normal_error);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,370 @@
+/***********************************/
+/*  FILE NAME: synthetic_gltf.cpp  */
+/***********************************/
+#include "synthetic_gltf.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <random>
+#include <vector>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+
+/* default constructor */
+SyntheticOptions::SyntheticOptions()
+    : joints(64)
+    , depth(0)
+    , vertices(4096)
+    , triangles(4096)
+    , influences(4)
+    , clips(1)
+    , keys(60)
+    , interpolation("LINEAR")
+    , duration(2.0f)
+    , textures(0)
+    , texture_size(256)
+    , seed(1234)
+{ /* empty */ }
+
+/* copy constructor */
+SyntheticOptions::SyntheticOptions(const SyntheticOptions& other)
+    : joints(other.joints)
+    , depth(other.depth)
+    , vertices(other.vertices)
+    , triangles(other.triangles)
+    , influences(other.influences)
+    , clips(other.clips)
+    , keys(other.keys)
+    , interpolation(other.interpolation)
+    , duration(other.duration)
+    , textures(other.textures)
+    , texture_size(other.texture_size)
+    , seed(other.seed)
+{ /* empty */ }
+
+
+/* functions to draw from the generator                                                    */
+/* NOTE: the distributions of <random> are not the same in every standard library, so the */
+/*       values are made from the raw mt19937 output, which is the same everywhere         */
+static float Unit(std::mt19937& random)
+{
+    return static_cast<float>(random() >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+static float Positive(std::mt19937& random)
+{
+    return static_cast<float>(random() >> 8) * (1.0f / 16777216.0f);
+}
+
+static unsigned int Index(std::mt19937& random, unsigned int count)
+{
+    return static_cast<unsigned int>(random() % count);
+}
+
+/* function to append 'bytes' of 'data' to the buffer as a new view and accessor, returns the accessor */
+static int AddAccessor(tinygltf::Model& model, const void* data, std::size_t bytes, int component_type, int type, std::size_t count, int target)
+{
+    auto& buffer = model.buffers[0].data;
+    buffer.resize((buffer.size() + 3) / 4 * 4);
+
+    tinygltf::BufferView view;
+    view.buffer = 0;
+    view.byteOffset = buffer.size();
+    view.byteLength = bytes;
+    view.target = target;
+    buffer.resize(buffer.size() + bytes);
+    std::memcpy(buffer.data() + view.byteOffset, data, bytes);
+    model.bufferViews.push_back(view);
+
+    /* NOTE: tinygltf leaves the offset and the normalized flag of an accessor uninitialized */
+    tinygltf::Accessor accessor;
+    accessor.bufferView = static_cast<int>(model.bufferViews.size() - 1);
+    accessor.byteOffset = 0;
+    accessor.normalized = false;
+    accessor.componentType = component_type;
+    accessor.type = type;
+    accessor.count = count;
+    model.accessors.push_back(accessor);
+    return static_cast<int>(model.accessors.size() - 1);
+}
+
+/* function to add the joint nodes (1 to 'joints')                                           */
+/* NOTE: without a depth a joint hangs off one of the 4 joints before it, so the tree stays  */
+/*       wide and shallow like a character skeleton. with a depth the first joints make one */
+/*       chain of that length and the others hang off any joint above the last level        */
+static void AddJoints(tinygltf::Model& model, const SyntheticOptions& options, std::mt19937& random,
+                      std::vector<float>& bind_translations, std::vector<float>& world_translations)
+{
+    const unsigned int num_joints = static_cast<unsigned int>(bind_translations.size() / 3);
+    std::vector<int> parents(num_joints);
+    std::vector<unsigned int> levels(num_joints);
+    std::vector<int> open_joints;
+    for(unsigned int i = 0; i < num_joints; ++i)
+    {
+        if(i == 0)
+            parents[i] = -1;
+        else if(options.depth == 0)
+            parents[i] = static_cast<int>(i - 1 - Index(random, std::min(i, 4U)));
+        else if(i < options.depth)
+            parents[i] = static_cast<int>(i - 1);
+        else
+            parents[i] = open_joints.empty() ? -1 : open_joints[Index(random, static_cast<unsigned int>(open_joints.size()))];
+        levels[i] = (parents[i] < 0) ? 1 : levels[parents[i]] + 1;
+        if(levels[i] < options.depth)
+            open_joints.push_back(static_cast<int>(i));
+
+        const float translation[3] = { 0.2f * Unit(random), 0.1f + 0.2f * Positive(random), 0.2f * Unit(random) };
+        for(unsigned int c = 0; c < 3; ++c)
+        {
+            bind_translations[i * 3 + c] = translation[c];
+            world_translations[i * 3 + c] = translation[c] + ((parents[i] < 0) ? 0.0f : world_translations[parents[i] * 3 + c]);
+        }
+
+        tinygltf::Node& node = model.nodes[i + 1];
+        node.name = "joint_" + std::to_string(i);
+        node.translation = { translation[0], translation[1], translation[2] };
+        model.nodes[(parents[i] < 0) ? 0 : parents[i] + 1].children.push_back(static_cast<int>(i + 1));
+    }
+}
+
+/* function to add the skinned mesh, its vertices lie around the first joint they are bound to */
+static void AddMesh(tinygltf::Model& model, const SyntheticOptions& options, std::mt19937& random, const std::vector<float>& world_translations)
+{
+    const unsigned int num_joints = static_cast<unsigned int>(world_translations.size() / 3);
+    const unsigned int num_vertices = std::max(options.vertices, 3U);
+    const unsigned int num_influences = std::min(std::max(options.influences, 1U), 4U);
+
+    std::vector<float> positions(num_vertices * 3);
+    std::vector<float> normals(num_vertices * 3);
+    std::vector<float> texcoords(num_vertices * 2);
+    std::vector<unsigned short> joints(num_vertices * 4, 0);
+    std::vector<float> weights(num_vertices * 4, 0.0f);
+    std::vector<double> position_min(3, 1e30);
+    std::vector<double> position_max(3, -1e30);
+    for(unsigned int v = 0; v < num_vertices; ++v)
+    {
+        float sum = 0.0f;
+        for(unsigned int k = 0; k < num_influences; ++k)
+        {
+            joints[v * 4 + k] = static_cast<unsigned short>(Index(random, num_joints));
+            weights[v * 4 + k] = Positive(random) + 0.01f;
+            sum += weights[v * 4 + k];
+        }
+        for(unsigned int k = 0; k < num_influences; ++k)
+            weights[v * 4 + k] /= sum;
+
+        const float nx = Unit(random), ny = Unit(random), nz = Unit(random);
+        const float length = std::max(std::sqrt(nx * nx + ny * ny + nz * nz), 1.0e-3f);
+        const unsigned int anchor = joints[v * 4];
+        for(unsigned int c = 0; c < 3; ++c)
+        {
+            positions[v * 3 + c] = world_translations[anchor * 3 + c] + 0.1f * Unit(random);
+            position_min[c] = std::min<double>(position_min[c], positions[v * 3 + c]);
+            position_max[c] = std::max<double>(position_max[c], positions[v * 3 + c]);
+        }
+        normals[v * 3 + 0] = nx / length;
+        normals[v * 3 + 1] = ny / length;
+        normals[v * 3 + 2] = nz / length;
+        texcoords[v * 2 + 0] = Positive(random);
+        texcoords[v * 2 + 1] = Positive(random);
+    }
+
+    std::vector<unsigned int> indices(static_cast<std::size_t>(std::max(options.triangles, 1U)) * 3);
+    for(auto& index : indices)
+        index = Index(random, num_vertices);
+
+    tinygltf::Primitive primitive;
+    primitive.mode = TINYGLTF_MODE_TRIANGLES;
+    primitive.material = (options.textures > 0) ? 0 : -1;
+    primitive.attributes["POSITION"] = AddAccessor(model, positions.data(), positions.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, num_vertices, TINYGLTF_TARGET_ARRAY_BUFFER);
+    model.accessors.back().minValues = position_min;
+    model.accessors.back().maxValues = position_max;
+    primitive.attributes["NORMAL"] = AddAccessor(model, normals.data(), normals.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, num_vertices, TINYGLTF_TARGET_ARRAY_BUFFER);
+    primitive.attributes["TEXCOORD_0"] = AddAccessor(model, texcoords.data(), texcoords.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC2, num_vertices, TINYGLTF_TARGET_ARRAY_BUFFER);
+    primitive.attributes["JOINTS_0"] = AddAccessor(model, joints.data(), joints.size() * sizeof(unsigned short), TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, TINYGLTF_TYPE_VEC4, num_vertices, TINYGLTF_TARGET_ARRAY_BUFFER);
+    primitive.attributes["WEIGHTS_0"] = AddAccessor(model, weights.data(), weights.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC4, num_vertices, TINYGLTF_TARGET_ARRAY_BUFFER);
+    primitive.indices = AddAccessor(model, indices.data(), indices.size() * sizeof(unsigned int), TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT, TINYGLTF_TYPE_SCALAR, indices.size(), TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER);
+
+    tinygltf::Mesh mesh;
+    mesh.name = "synthetic";
+    mesh.primitives.push_back(primitive);
+    model.meshes.push_back(mesh);
+}
+
+/* function to add the skin, the bind pose has no rotation so a joint is undone by */
+/* its world translation (column major)                                             */
+static void AddSkin(tinygltf::Model& model, const std::vector<float>& world_translations)
+{
+    const unsigned int num_joints = static_cast<unsigned int>(world_translations.size() / 3);
+    std::vector<float> inverse_bind_matrices(num_joints * 16, 0.0f);
+    tinygltf::Skin skin;
+    skin.skeleton = 1;
+    for(unsigned int i = 0; i < num_joints; ++i)
+    {
+        float* matrix = &inverse_bind_matrices[i * 16];
+        matrix[0] = matrix[5] = matrix[10] = matrix[15] = 1.0f;
+        matrix[12] = -world_translations[i * 3 + 0];
+        matrix[13] = -world_translations[i * 3 + 1];
+        matrix[14] = -world_translations[i * 3 + 2];
+        skin.joints.push_back(static_cast<int>(i + 1));
+    }
+    skin.inverseBindMatrices = AddAccessor(model, inverse_bind_matrices.data(), inverse_bind_matrices.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_MAT4, num_joints, 0);
+    model.skins.push_back(skin);
+}
+
+/* function to add a clip swinging every joint around its own axis, all tracks share the key times */
+/* NOTE: a cubic spline key stores an in tangent, the value and an out tangent, the tangents are 0  */
+static void AddClip(tinygltf::Model& model, const SyntheticOptions& options, std::mt19937& random, unsigned int clip, const std::vector<float>& bind_translations)
+{
+    const unsigned int num_joints = static_cast<unsigned int>(bind_translations.size() / 3);
+    const unsigned int num_keys = std::max(options.keys, 2U);
+    const bool cubic_spline = (options.interpolation == "CUBICSPLINE");
+    const unsigned int values_per_key = cubic_spline ? 3 : 1;
+
+    std::vector<float> times(num_keys);
+    for(unsigned int k = 0; k < num_keys; ++k)
+        times[k] = options.duration * static_cast<float>(k) / static_cast<float>(num_keys - 1);
+    const int input = AddAccessor(model, times.data(), times.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_SCALAR, num_keys, 0);
+    model.accessors.back().minValues = { times.front() };
+    model.accessors.back().maxValues = { times.back() };
+
+    tinygltf::Animation animation;
+    animation.name = "clip_" + std::to_string(clip);
+    std::vector<float> rotations(num_keys * values_per_key * 4, 0.0f);
+    std::vector<float> translations(num_keys * values_per_key * 3, 0.0f);
+    for(unsigned int i = 0; i < num_joints; ++i)
+    {
+        const float ax = Unit(random), ay = Unit(random), az = Unit(random);
+        const float axis_length = std::max(std::sqrt(ax * ax + ay * ay + az * az), 1.0e-3f);
+        const float phase = 6.2831853f * Positive(random);
+        for(unsigned int k = 0; k < num_keys; ++k)
+        {
+            const float angle = 0.5f * std::sin(phase + 6.2831853f * static_cast<float>(k) / static_cast<float>(num_keys - 1));
+            const float s = std::sin(angle * 0.5f) / axis_length;
+            float* rotation = &rotations[(k * values_per_key + values_per_key / 2) * 4];
+            float* translation = &translations[(k * values_per_key + values_per_key / 2) * 3];
+            rotation[0] = ax * s;
+            rotation[1] = ay * s;
+            rotation[2] = az * s;
+            rotation[3] = std::cos(angle * 0.5f);
+            for(unsigned int c = 0; c < 3; ++c)
+                translation[c] = bind_translations[i * 3 + c] * (1.0f + 0.05f * std::sin(phase + static_cast<float>(k)));
+        }
+
+        const int rotation_output = AddAccessor(model, rotations.data(), rotations.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC4, num_keys * values_per_key, 0);
+        const int translation_output = AddAccessor(model, translations.data(), translations.size() * sizeof(float), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, num_keys * values_per_key, 0);
+        const std::pair<int, const char*> tracks[] = { { rotation_output, "rotation" }, { translation_output, "translation" } };
+        for(const auto& track : tracks)
+        {
+            tinygltf::AnimationSampler sampler;
+            sampler.input = input;
+            sampler.output = track.first;
+            sampler.interpolation = options.interpolation;
+            animation.samplers.push_back(sampler);
+
+            tinygltf::AnimationChannel channel;
+            channel.sampler = static_cast<int>(animation.samplers.size() - 1);
+            channel.target_node = static_cast<int>(i + 1);
+            channel.target_path = track.second;
+            animation.channels.push_back(channel);
+        }
+    }
+    model.animations.push_back(animation);
+}
+
+/* function to add a base color texture and its material                                 */
+/* NOTE: the image is a noisy checker board of two colors, the writer embeds it as a PNG */
+/*       (stb_image_write) so loading it costs a real decode                              */
+static void AddTexture(tinygltf::Model& model, const SyntheticOptions& options, std::mt19937& random, unsigned int texture_id)
+{
+    const unsigned int size = std::max(options.texture_size, 1U);
+    const unsigned int cell = std::max(size / 8, 1U);
+    unsigned char colors[2][3];
+    for(auto& color : colors)
+    {
+        for(auto& channel : color)
+            channel = static_cast<unsigned char>(Index(random, 256));
+    }
+
+    tinygltf::Image image;
+    image.name = "texture_" + std::to_string(texture_id);
+    image.mimeType = "image/png";
+    image.width = static_cast<int>(size);
+    image.height = static_cast<int>(size);
+    image.component = 4;
+    image.bits = 8;
+    image.pixel_type = TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+    image.image.resize(static_cast<std::size_t>(size) * size * 4);
+    for(unsigned int y = 0; y < size; ++y)
+    {
+        for(unsigned int x = 0; x < size; ++x)
+        {
+            const unsigned char* color = colors[((x / cell) + (y / cell)) % 2];
+            unsigned char* pixel = &image.image[(static_cast<std::size_t>(y) * size + x) * 4];
+            for(unsigned int c = 0; c < 3; ++c)
+                pixel[c] = static_cast<unsigned char>(std::min(std::max(static_cast<int>(color[c]) + static_cast<int>(Index(random, 33)) - 16, 0), 255));
+            pixel[3] = 255;
+        }
+    }
+    model.images.push_back(image);
+
+    tinygltf::Texture texture;
+    texture.source = static_cast<int>(model.images.size() - 1);
+    texture.sampler = 0;
+    model.textures.push_back(texture);
+
+    tinygltf::Material material;
+    material.name = "material_" + std::to_string(texture_id);
+    material.values["baseColorTexture"].json_double_value["index"] = static_cast<double>(model.textures.size() - 1);
+    model.materials.push_back(material);
+}
+
+/* function to generate one skinned mesh on a random joint tree with its clips and textures */
+tinygltf::Model MakeSyntheticModel(const SyntheticOptions& options)
+{
+    if(options.interpolation != "LINEAR" && options.interpolation != "STEP" && options.interpolation != "CUBICSPLINE")
+        throw std::runtime_error("Undefined interpolation(" + options.interpolation + ")");
+    const unsigned int num_joints = std::max(options.joints, 1U);
+
+    std::mt19937 random(options.seed);
+    tinygltf::Model model;
+    model.asset.version = "2.0";
+    model.asset.generator = "glTF_Animation synthetic";
+    model.buffers.resize(1);
+
+    /* node 0 is the skinned mesh and the root of the scene */
+    std::vector<float> bind_translations(num_joints * 3);
+    std::vector<float> world_translations(num_joints * 3);
+    model.nodes.resize(num_joints + 1);
+    model.nodes[0].name = "mesh";
+    model.nodes[0].mesh = 0;
+    model.nodes[0].skin = 0;
+    AddJoints(model, options, random, bind_translations, world_translations);
+    AddMesh(model, options, random, world_translations);
+    AddSkin(model, world_translations);
+    for(unsigned int clip = 0; clip < options.clips; ++clip)
+        AddClip(model, options, random, clip, bind_translations);
+
+    if(options.textures > 0)
+        model.samplers.push_back(tinygltf::Sampler());
+    for(unsigned int texture_id = 0; texture_id < options.textures; ++texture_id)
+        AddTexture(model, options, random, texture_id);
+
+    tinygltf::Scene scene;
+    scene.nodes.push_back(0);
+    model.scenes.push_back(scene);
+    model.defaultScene = 0;
+    model.buffers[0].data.resize((model.buffers[0].data.size() + 3) / 4 * 4);
+    return model;
+}
+
+/* function to write 'model' as a binary glTF (.glb) file */
+void WriteSyntheticModel(tinygltf::Model& model, const std::string& file)
+{
+    tinygltf::TinyGLTF writer;
+    if(writer.WriteGltfSceneToFile(&model, file, true, true, false, true) == false)
+        throw std::runtime_error("Failed to write glTF file(" + file + ")");
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*********************************/
+/*  FILE NAME: synthetic_gltf.h  */
+/*********************************/
+#ifndef _SYNTHETIC_GLTF_H_
+#define _SYNTHETIC_GLTF_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <string>
+#include <cstdint>
+#include <tiny_gltf.h>
+
+/**********************************/
+/*  CLASS NAME: SyntheticOptions  */
+/**********************************/
+/* sizes of a generated skinned model. the same options and seed always */
+/* give the same model.                                                  */
+class SyntheticOptions
+{
+public:
+    SyntheticOptions();
+    SyntheticOptions(const SyntheticOptions& other);
+
+public:
+    unsigned int joints;
+    unsigned int depth;         /* joints of the longest chain, 0 hangs each joint off one of the 4 before it */
+    unsigned int vertices;
+    unsigned int triangles;
+    unsigned int influences;    /* weighted joints of a vertex, 1 to 4 */
+    unsigned int clips;
+    unsigned int keys;          /* keys of each track, a rotation and a translation track per joint and clip */
+    std::string interpolation;  /* "LINEAR", "STEP" or "CUBICSPLINE" */
+    float duration;             /* seconds of a clip */
+    unsigned int textures;      /* base color textures, each with its own material */
+    unsigned int texture_size;  /* width and height of the textures */
+    std::uint32_t seed;
+}; // class SyntheticOptions
+
+tinygltf::Model MakeSyntheticModel(const SyntheticOptions& options);
+void WriteSyntheticModel(tinygltf::Model& model, const std::string& file);
+#endif // !_SYNTHETIC_GLTF_H_
\ No newline at end of file
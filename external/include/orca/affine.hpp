@@ -0,0 +1,141 @@
+/***************************/
+/*  FILE NAME: affine.hpp  */
+/***************************/
+#ifndef _ORCA_AFFINE_HPP_
+#define _ORCA_AFFINE_HPP_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "simd.hpp"
+#include "vector.hpp"
+
+namespace orca
+{
+    template<typename T> class vec3;
+    template<typename T> class vec4;
+}
+
+namespace orca
+{
+    /************************/
+    /*  CLASS NAME: affine  */
+    /************************/
+    /* affine transform stored as the upper 3x4 part of a 4x4 matrix.           */
+    /* each row holds one output axis (x, y, z) and the translation in w, so a  */
+    /* point is transformed with three dot products. the last row (0, 0, 0, 1)  */
+    /* is implicit. 'a * b' keeps the mat4<T> meaning: apply 'a' first, then 'b' */
+    template<typename T>
+    class affine
+    {
+    private:
+        using element_type = T;
+        using this_type = affine<element_type>;
+        using vector_type = vec4<element_type>;
+        static constexpr unsigned int max_row_size = 3;
+        static constexpr unsigned int max_col_size = 4;
+
+    public:
+        affine()
+        {
+            data[0] = vector_type(static_cast<element_type>(1.0), static_cast<element_type>(0.0), static_cast<element_type>(0.0), static_cast<element_type>(0.0));
+            data[1] = vector_type(static_cast<element_type>(0.0), static_cast<element_type>(1.0), static_cast<element_type>(0.0), static_cast<element_type>(0.0));
+            data[2] = vector_type(static_cast<element_type>(0.0), static_cast<element_type>(0.0), static_cast<element_type>(1.0), static_cast<element_type>(0.0));
+        }
+
+        affine(const vector_type& v0, const vector_type& v1, const vector_type& v2)
+        {
+            data[0] = v0;
+            data[1] = v1;
+            data[2] = v2;
+        }
+
+        affine(const this_type& other)
+        {
+            for(unsigned int i = 0; i < max_row_size; ++i)
+                for(unsigned int j = 0; j < max_col_size; ++j)
+                    data[i].data[j] = other.data[i].data[j];
+        }
+
+    public:
+        this_type& operator=(const this_type& rhs)
+        {
+            for(unsigned int i = 0; i < max_row_size; ++i)
+                for(unsigned int j = 0; j < max_col_size; ++j)
+                    data[i].data[j] = rhs.data[i].data[j];
+            return *this;
+        }
+
+        /* composition: the result applies 'this' first and 'rhs' second */
+        this_type operator*(const this_type& rhs) const
+        {
+            this_type result;
+            for(unsigned int i = 0; i < max_row_size; ++i)
+            {
+                const element_type b0 = rhs.data[i].data[0];
+                const element_type b1 = rhs.data[i].data[1];
+                const element_type b2 = rhs.data[i].data[2];
+                for(unsigned int j = 0; j < max_col_size; ++j)
+                    result.data[i].data[j] = b0 * data[0].data[j] + b1 * data[1].data[j] + b2 * data[2].data[j];
+                result.data[i].data[3] += rhs.data[i].data[3];
+            }
+            return result;
+        }
+
+        this_type& operator*=(const this_type& rhs)
+        {
+            return (*this = *this * rhs);
+        }
+
+        vector_type& operator[](unsigned int index)
+        {
+            if(!(0 <= index && index < max_row_size))
+                throw std::out_of_range("class \'affine<T>\' error: out of range.");
+            return data[index];
+        }
+
+        const vector_type& operator[](unsigned int index) const
+        {
+            if(!(0 <= index && index < max_row_size))
+                throw std::out_of_range("class \'affine<T>\' error: out of range.");
+            return data[index];
+        }
+
+        operator element_type* () { return &data[0].data[0]; }
+        operator const element_type* () const { return &data[0].data[0]; }
+        unsigned int RowSize() const { return max_row_size; }
+        unsigned int ColSize() const { return max_col_size; }
+
+    public:
+        vector_type data[max_row_size];
+    }; // class affine<T>
+
+#if defined(ORCA_SIMD_SSE2)
+    /* affine<float> composition using SSE2, in the scalar summation order */
+    template<>
+    inline affine<float> affine<float>::operator*(const affine<float>& rhs) const
+    {
+        const __m128 a0 = _mm_load_ps(data[0].data);
+        const __m128 a1 = _mm_load_ps(data[1].data);
+        const __m128 a2 = _mm_load_ps(data[2].data);
+        const __m128 mask_w = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+        affine<float> result;
+        for(unsigned int i = 0; i < max_row_size; ++i)
+        {
+            const __m128 b = _mm_load_ps(rhs.data[i].data);
+            __m128 sum = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)), a0);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)), a1));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)), a2));
+            sum = _mm_add_ps(sum, _mm_and_ps(b, mask_w));
+            _mm_store_ps(result.data[i].data, sum);
+        }
+        return result;
+    }
+#endif
+
+} // namespace orca
+#endif // !_ORCA_AFFINE_HPP_
\ No newline at end of file
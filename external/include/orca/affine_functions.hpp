@@ -0,0 +1,165 @@
+/*************************************/
+/*  FILE NAME: affine_functions.hpp  */
+/*************************************/
+#ifndef _ORCA_AFFINE_FUNCTIONS_HPP_
+#define _ORCA_AFFINE_FUNCTIONS_HPP_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include "vector.hpp"
+#include "matrix.hpp"
+#include "affine.hpp"
+#include "quaternion.hpp"
+
+namespace orca
+{
+    /* print affine<T> data */
+    template<typename T>
+    inline void PrintMatrix(const affine<T>& mat)
+    {
+        for(unsigned int i = 0; i < mat.RowSize(); ++i)
+        {
+            for(unsigned int j = 0; j < mat.ColSize(); ++j)
+                std::cout << mat[i][j] << " ";
+            std::cout << std::endl;
+        }
+    }
+
+    /* return identity affine<T> */
+    template<typename T>
+    inline affine<T> Identity(const affine<T>& mat)
+    {
+        return affine<T>();
+    }
+
+    /* make affine<T> type from the affine part of a mat4<T> */
+    template<typename T>
+    inline affine<T> MakeAffine(const mat4<T>& mat)
+    {
+        affine<T> result;
+        for(unsigned int i = 0; i < result.RowSize(); ++i)
+            for(unsigned int j = 0; j < result.ColSize(); ++j)
+                result.data[i].data[j] = mat.data[j].data[i];
+        return result;
+    }
+
+    /* make affine<T> type from scale, rotation and translation       */
+    /* (same result as 'Scale(s) * QuaternionToMatrix(q) * Translate(t)') */
+    template<typename T>
+    inline affine<T> MakeAffine(const vec3<T>& scale, const quaternion<T>& quat, const vec3<T>& translate)
+    {
+        const T xx = quat.x * quat.x;
+        const T yy = quat.y * quat.y;
+        const T zz = quat.z * quat.z;
+        const T xy = quat.x * quat.y;
+        const T xz = quat.x * quat.z;
+        const T xw = quat.x * quat.r;
+        const T yz = quat.y * quat.z;
+        const T yw = quat.y * quat.r;
+        const T zw = quat.z * quat.r;
+
+        affine<T> result;
+        result.data[0].data[0] = (static_cast<T>(1.0) - static_cast<T>(2.0) * (yy + zz)) * scale.x;
+        result.data[0].data[1] = (static_cast<T>(2.0) * (xy - zw)) * scale.y;
+        result.data[0].data[2] = (static_cast<T>(2.0) * (xz + yw)) * scale.z;
+        result.data[0].data[3] = translate.x;
+
+        result.data[1].data[0] = (static_cast<T>(2.0) * (xy + zw)) * scale.x;
+        result.data[1].data[1] = (static_cast<T>(1.0) - static_cast<T>(2.0) * (xx + zz)) * scale.y;
+        result.data[1].data[2] = (static_cast<T>(2.0) * (yz - xw)) * scale.z;
+        result.data[1].data[3] = translate.y;
+
+        result.data[2].data[0] = (static_cast<T>(2.0) * (xz - yw)) * scale.x;
+        result.data[2].data[1] = (static_cast<T>(2.0) * (yz + xw)) * scale.y;
+        result.data[2].data[2] = (static_cast<T>(1.0) - static_cast<T>(2.0) * (xx + yy)) * scale.z;
+        result.data[2].data[3] = translate.z;
+        return result;
+    }
+
+    /* make mat4<T> type from affine<T> */
+    template<typename T>
+    inline mat4<T> MakeMatrix4X4(const affine<T>& mat)
+    {
+        mat4<T> result;
+        for(unsigned int i = 0; i < mat.RowSize(); ++i)
+            for(unsigned int j = 0; j < mat.ColSize(); ++j)
+                result.data[j].data[i] = mat.data[i].data[j];
+        result.data[0].data[3] = static_cast<T>(0.0);
+        result.data[1].data[3] = static_cast<T>(0.0);
+        result.data[2].data[3] = static_cast<T>(0.0);
+        result.data[3].data[3] = static_cast<T>(1.0);
+        return result;
+    }
+
+    /* return determinant of the linear part of affine<T> */
+    template<typename T>
+    inline T Determinant(const affine<T>& mat)
+    {
+        const vec4<T>* m = mat.data;
+        return m[0].data[0] * (m[1].data[1] * m[2].data[2] - m[1].data[2] * m[2].data[1])
+             - m[0].data[1] * (m[1].data[0] * m[2].data[2] - m[1].data[2] * m[2].data[0])
+             + m[0].data[2] * (m[1].data[0] * m[2].data[1] - m[1].data[1] * m[2].data[0]);
+    }
+
+    /* return inverse of affine<T>                                  */
+    /* NOTE: never throws, a singular matrix returns the identity   */
+    template<typename T>
+    inline affine<T> Inverse(const affine<T>& mat)
+    {
+        const vec4<T>* m = mat.data;
+        const T c00 = m[1].data[1] * m[2].data[2] - m[1].data[2] * m[2].data[1];
+        const T c01 = m[1].data[2] * m[2].data[0] - m[1].data[0] * m[2].data[2];
+        const T c02 = m[1].data[0] * m[2].data[1] - m[1].data[1] * m[2].data[0];
+        const T det = m[0].data[0] * c00 + m[0].data[1] * c01 + m[0].data[2] * c02;
+        if(std::abs(det) <= std::numeric_limits<T>::min())
+            return affine<T>();
+
+        const T inv_det = static_cast<T>(1.0) / det;
+        affine<T> result;
+        result.data[0].data[0] = c00 * inv_det;
+        result.data[0].data[1] = (m[0].data[2] * m[2].data[1] - m[0].data[1] * m[2].data[2]) * inv_det;
+        result.data[0].data[2] = (m[0].data[1] * m[1].data[2] - m[0].data[2] * m[1].data[1]) * inv_det;
+
+        result.data[1].data[0] = c01 * inv_det;
+        result.data[1].data[1] = (m[0].data[0] * m[2].data[2] - m[0].data[2] * m[2].data[0]) * inv_det;
+        result.data[1].data[2] = (m[0].data[2] * m[1].data[0] - m[0].data[0] * m[1].data[2]) * inv_det;
+
+        result.data[2].data[0] = c02 * inv_det;
+        result.data[2].data[1] = (m[0].data[1] * m[2].data[0] - m[0].data[0] * m[2].data[1]) * inv_det;
+        result.data[2].data[2] = (m[0].data[0] * m[1].data[1] - m[0].data[1] * m[1].data[0]) * inv_det;
+
+        for(unsigned int i = 0; i < result.RowSize(); ++i)
+        {
+            result.data[i].data[3] = -(result.data[i].data[0] * m[0].data[3]
+                                     + result.data[i].data[1] * m[1].data[3]
+                                     + result.data[i].data[2] * m[2].data[3]);
+        }
+        return result;
+    }
+
+    /* return the point transformed by affine<T> (translation applied) */
+    template<typename T>
+    inline vec3<T> TransformPoint(const affine<T>& mat, const vec3<T>& point)
+    {
+        vec3<T> result;
+        for(unsigned int i = 0; i < mat.RowSize(); ++i)
+            result.data[i] = mat.data[i].data[0] * point.x + mat.data[i].data[1] * point.y + mat.data[i].data[2] * point.z + mat.data[i].data[3];
+        return result;
+    }
+
+    /* return the direction transformed by affine<T> (translation ignored) */
+    template<typename T>
+    inline vec3<T> TransformVector(const affine<T>& mat, const vec3<T>& vec)
+    {
+        vec3<T> result;
+        for(unsigned int i = 0; i < mat.RowSize(); ++i)
+            result.data[i] = mat.data[i].data[0] * vec.x + mat.data[i].data[1] * vec.y + mat.data[i].data[2] * vec.z;
+        return result;
+    }
+
+} // namespace orca
+#endif // !_ORCA_AFFINE_FUNCTIONS_HPP_
\ No newline at end of file
@@ -0,0 +1,106 @@
+/************************************/
+/*  FILE NAME: dual_quaternion.hpp  */
+/************************************/
+#ifndef _ORCA_DUAL_QUATERNION_HPP_
+#define _ORCA_DUAL_QUATERNION_HPP_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <stdexcept>
+#include "quaternion.hpp"
+
+namespace orca
+{
+    /*********************************/
+    /*  CLASS NAME: dual_quaternion  */
+    /*********************************/
+    /* rigid transform as 'real + e * dual'. 'real' is the rotation and      */
+    /* 'dual' is '0.5 * t * real' for the translation t. the data is stored  */
+    /* as 8 contiguous elements: real (r, x, y, z) followed by dual (r, x, y, z) */
+    template<typename T>
+    class dual_quaternion
+    {
+    private:
+        using element_type = T;
+        using this_type = dual_quaternion<element_type>;
+        using quaternion_type = quaternion<element_type>;
+        static constexpr unsigned int max_data_size = 2;
+
+    public:
+        dual_quaternion() : real(static_cast<element_type>(1.0), static_cast<element_type>(0.0), static_cast<element_type>(0.0), static_cast<element_type>(0.0)), dual() {}
+        dual_quaternion(const quaternion_type& real, const quaternion_type& dual) : real(real), dual(dual) {}
+        dual_quaternion(const this_type& other) : real(other.real), dual(other.dual) {}
+
+    public:
+        this_type& operator=(const this_type& rhs)
+        {
+            real = rhs.real;
+            dual = rhs.dual;
+            return *this;
+        }
+
+        this_type operator+(const this_type& rhs) const
+        {
+            return this_type(real + rhs.real, dual + rhs.dual);
+        }
+
+        this_type& operator+=(const this_type& rhs)
+        {
+            return (*this = *this + rhs);
+        }
+
+        this_type operator*(element_type rhs) const
+        {
+            return this_type(real * rhs, dual * rhs);
+        }
+
+        this_type& operator*=(element_type rhs)
+        {
+            return (*this = *this * rhs);
+        }
+
+        /* composition: the result applies 'rhs' first and 'this' second */
+        this_type operator*(const this_type& rhs) const
+        {
+            return this_type(real * rhs.real, real * rhs.dual + dual * rhs.real);
+        }
+
+        this_type& operator*=(const this_type& rhs)
+        {
+            return (*this = *this * rhs);
+        }
+
+        quaternion_type& operator[](unsigned int index)
+        {
+            if(!(0 <= index && index < max_data_size))
+                throw std::out_of_range("class \'dual_quaternion<T>\' error: out of range.");
+            return (index == 0) ? real : dual;
+        }
+
+        const quaternion_type& operator[](unsigned int index) const
+        {
+            if(!(0 <= index && index < max_data_size))
+                throw std::out_of_range("class \'dual_quaternion<T>\' error: out of range.");
+            return (index == 0) ? real : dual;
+        }
+
+        operator element_type* () { return &real.data[0]; }
+        operator const element_type* () const { return &real.data[0]; }
+        unsigned int Size() const { return max_data_size; }
+
+    public:
+        quaternion_type real;
+        quaternion_type dual;
+    }; // class dual_quaternion<T>
+
+    template<typename T>
+    dual_quaternion<T> operator*(T lhs, const dual_quaternion<T>& rhs)
+    {
+        return rhs * lhs;
+    }
+
+    using dual_quaternionf = dual_quaternion<float>;
+    using dual_quaterniond = dual_quaternion<double>;
+} // namespace orca
+#endif // !_ORCA_DUAL_QUATERNION_HPP_
\ No newline at end of file
@@ -0,0 +1,131 @@
+/**********************************************/
+/*  FILE NAME: dual_quaternion_functions.hpp  */
+/**********************************************/
+#ifndef _ORCA_DUAL_QUATERNION_FUNCTIONS_HPP_
+#define _ORCA_DUAL_QUATERNION_FUNCTIONS_HPP_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <limits>
+#include <iostream>
+
+#include "vector.hpp"
+#include "affine.hpp"
+#include "quaternion.hpp"
+#include "quaternion_functions.hpp"
+#include "dual_quaternion.hpp"
+
+namespace orca
+{
+    /* print dual_quaternion data */
+    template<typename T>
+    inline void PrintDualQuaternion(const dual_quaternion<T>& dq)
+    {
+        std::cout << "(" << dq.real.r << ", " << dq.real.x << ", " << dq.real.y << ", " << dq.real.z << ") + e"
+                  << "(" << dq.dual.r << ", " << dq.dual.x << ", " << dq.dual.y << ", " << dq.dual.z << ")" << std::endl;
+    }
+
+    /* make dual_quaternion<T> type from rotation and translation */
+    template<typename T>
+    inline dual_quaternion<T> MakeDualQuaternion(const quaternion<T>& rotation, const vec3<T>& translate)
+    {
+        return dual_quaternion<T>(rotation, quaternion<T>(translate) * rotation * static_cast<T>(0.5));
+    }
+
+    /* make dual_quaternion<T> type from the rigid part of affine<T>            */
+    /* NOTE: scale is divided out of each axis and dropped, shear is not handled */
+    template<typename T>
+    inline dual_quaternion<T> MakeDualQuaternion(const affine<T>& mat)
+    {
+        /* column j of the linear part is the image of axis j */
+        T m[3][3];
+        for(unsigned int j = 0; j < 3; ++j)
+        {
+            const T len = std::sqrt(mat.data[0].data[j] * mat.data[0].data[j] + mat.data[1].data[j] * mat.data[1].data[j] + mat.data[2].data[j] * mat.data[2].data[j]);
+            const T inv_len = (len <= std::numeric_limits<T>::min()) ? static_cast<T>(0.0) : static_cast<T>(1.0) / len;
+            for(unsigned int i = 0; i < 3; ++i)
+                m[i][j] = mat.data[i].data[j] * inv_len;
+        }
+
+        /* rotation matrix to quaternion, pivoting on the largest diagonal term */
+        quaternion<T> rotation;
+        const T trace = m[0][0] + m[1][1] + m[2][2];
+        if(trace > static_cast<T>(0.0))
+        {
+            const T s = std::sqrt(trace + static_cast<T>(1.0)) * static_cast<T>(2.0);
+            rotation.r = static_cast<T>(0.25) * s;
+            rotation.x = (m[2][1] - m[1][2]) / s;
+            rotation.y = (m[0][2] - m[2][0]) / s;
+            rotation.z = (m[1][0] - m[0][1]) / s;
+        }
+        else if(m[0][0] > m[1][1] && m[0][0] > m[2][2])
+        {
+            const T s = std::sqrt(static_cast<T>(1.0) + m[0][0] - m[1][1] - m[2][2]) * static_cast<T>(2.0);
+            rotation.r = (m[2][1] - m[1][2]) / s;
+            rotation.x = static_cast<T>(0.25) * s;
+            rotation.y = (m[0][1] + m[1][0]) / s;
+            rotation.z = (m[0][2] + m[2][0]) / s;
+        }
+        else if(m[1][1] > m[2][2])
+        {
+            const T s = std::sqrt(static_cast<T>(1.0) + m[1][1] - m[0][0] - m[2][2]) * static_cast<T>(2.0);
+            rotation.r = (m[0][2] - m[2][0]) / s;
+            rotation.x = (m[0][1] + m[1][0]) / s;
+            rotation.y = static_cast<T>(0.25) * s;
+            rotation.z = (m[1][2] + m[2][1]) / s;
+        }
+        else
+        {
+            const T s = std::sqrt(static_cast<T>(1.0) + m[2][2] - m[0][0] - m[1][1]) * static_cast<T>(2.0);
+            rotation.r = (m[1][0] - m[0][1]) / s;
+            rotation.x = (m[0][2] + m[2][0]) / s;
+            rotation.y = (m[1][2] + m[2][1]) / s;
+            rotation.z = static_cast<T>(0.25) * s;
+        }
+
+        return MakeDualQuaternion(Normalize(rotation), vec3<T>(mat.data[0].data[3], mat.data[1].data[3], mat.data[2].data[3]));
+    }
+
+    /* return unit dual_quaternion<T> (divided by the length of the real part) */
+    template<typename T>
+    inline dual_quaternion<T> Normalize(const dual_quaternion<T>& dq)
+    {
+        T squared = static_cast<T>(0.0);
+        for(unsigned int i = 0; i < dq.real.Size(); ++i)
+            squared += dq.real.data[i] * dq.real.data[i];
+        if(squared <= std::numeric_limits<T>::min())
+            return dual_quaternion<T>();
+        return dq * (static_cast<T>(1.0) / std::sqrt(squared));
+    }
+
+    /* return the translation of a unit dual_quaternion<T> */
+    template<typename T>
+    inline vec3<T> GetTranslation(const dual_quaternion<T>& dq)
+    {
+        const quaternion<T> t = dq.dual * Conjugate(dq.real) * static_cast<T>(2.0);
+        return vec3<T>(t.x, t.y, t.z);
+    }
+
+    /* return the point transformed by a unit dual_quaternion<T> */
+    /* (same formula as GLSL/anim_dq_vert.glsl)                  */
+    template<typename T>
+    inline vec3<T> TransformPoint(const dual_quaternion<T>& dq, const vec3<T>& point)
+    {
+        const vec3<T> r(dq.real.x, dq.real.y, dq.real.z);
+        const vec3<T> d(dq.dual.x, dq.dual.y, dq.dual.z);
+        const vec3<T> rotated = point + static_cast<T>(2.0) * Cross(r, Cross(r, point) + dq.real.r * point);
+        return rotated + static_cast<T>(2.0) * (dq.real.r * d - dq.dual.r * r + Cross(r, d));
+    }
+
+    /* return the direction transformed by a unit dual_quaternion<T> (translation ignored) */
+    template<typename T>
+    inline vec3<T> TransformVector(const dual_quaternion<T>& dq, const vec3<T>& vec)
+    {
+        const vec3<T> r(dq.real.x, dq.real.y, dq.real.z);
+        return vec + static_cast<T>(2.0) * Cross(r, Cross(r, vec) + dq.real.r * vec);
+    }
+
+} // namespace orca
+#endif // !_ORCA_DUAL_QUATERNION_FUNCTIONS_HPP_
\ No newline at end of file
@@ -264,7 +264,7 @@ namespace orca
         }
 
         operator element_type* () { return &data[0][0]; }
-        operator const element_type* () const { return &data[0][0]; }
+        operator const element_type* () const { return &data[0].data[0]; }
         const unsigned int RowSize() const { return max_row_size; }
         const unsigned int ColSize() const { return max_col_size; }
 
@@ -10,6 +10,7 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include "simd.hpp"
 #include "matrix.hpp"
 
 namespace orca
@@ -47,8 +48,7 @@ namespace orca
         mat4(const this_type& other)
         {
             for(unsigned int i = 0; i < max_row_size; ++i)
-                for(unsigned int j = 0; j < max_col_size; ++j)
-                    data[i][j] = other.data[i][j];
+                data[i] = other.data[i];
         }
 
         explicit mat4(element_type num)
@@ -99,8 +99,7 @@ namespace orca
         this_type& operator=(const this_type& rhs)
         {
             for(unsigned int i = 0; i < max_row_size; ++i)
-                for(unsigned int j = 0; j < max_col_size; ++j)
-                    data[i][j] = rhs.data[i][j];
+                data[i] = rhs.data[i];
             return *this;
         }
 
@@ -265,7 +264,7 @@ namespace orca
         }
 
         operator element_type* () { return &data[0][0]; }
-        operator const element_type* () const { return &data[0][0]; }
+        operator const element_type* () const { return &data[0].data[0]; }
         const unsigned int RowSize() const { return max_row_size; }
         const unsigned int ColSize() const { return max_col_size; }
 
@@ -319,5 +318,60 @@ namespace orca
         return result;
     }
 
+#if defined(ORCA_SIMD_SSE2)
+    /* mat4<float> multiplication using SSE2 (two rows per step with AVX2)       */
+    /* NOTE: products are summed in the scalar order, so results are identical */
+    template<>
+    inline mat4<float> mat4<float>::operator*(const mat4<float>& rhs) const
+    {
+        mat4<float> result;
+#if defined(ORCA_SIMD_AVX2)
+        const __m256 r0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs.data[0].data));
+        const __m256 r1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs.data[1].data));
+        const __m256 r2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs.data[2].data));
+        const __m256 r3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs.data[3].data));
+        for(unsigned int i = 0; i < max_row_size; i += 2)
+        {
+            const __m256 row = _mm256_loadu_ps(data[i].data);
+            __m256 sum = _mm256_mul_ps(_mm256_permute_ps(row, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(row, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(row, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(row, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+            _mm256_storeu_ps(result.data[i].data, sum);
+        }
+#else
+        const __m128 r0 = _mm_load_ps(rhs.data[0].data);
+        const __m128 r1 = _mm_load_ps(rhs.data[1].data);
+        const __m128 r2 = _mm_load_ps(rhs.data[2].data);
+        const __m128 r3 = _mm_load_ps(rhs.data[3].data);
+        for(unsigned int i = 0; i < max_row_size; ++i)
+        {
+            const __m128 row = _mm_load_ps(data[i].data);
+            __m128 sum = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+            _mm_store_ps(result.data[i].data, sum);
+        }
+#endif
+        return result;
+    }
+
+    /* vec4<float> * mat4<float> using SSE2 */
+    template<>
+    inline vec4<float> operator*(const vec4<float>& lhs, const mat4<float>& rhs)
+    {
+        const __m128 v = _mm_load_ps(lhs.data);
+        __m128 sum = _mm_mul_ps(_mm_load_ps(rhs.data[0].data), _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(rhs.data[1].data), _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(rhs.data[2].data), _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(rhs.data[3].data), _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+
+        vec4<float> result;
+        _mm_store_ps(result.data, sum);
+        return result;
+    }
+#endif
+
 } // namespace orca
 #endif // !_ORCA_MAT4_HPP_
\ No newline at end of file
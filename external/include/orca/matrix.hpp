@@ -8,6 +8,7 @@
 #include "mat2.hpp"
 #include "mat3.hpp"
 #include "mat4.hpp"
+#include "affine.hpp"
 
 namespace orca
 {
@@ -22,5 +23,8 @@ namespace orca
     using mat4i = mat4<int>;
     using mat4f = mat4<float>;
     using mat4d = mat4<double>;
+
+    using affinef = affine<float>;
+    using affined = affine<double>;
 } // namespace orca
 #endif // !_ORCA_MATRIX_HPP_
\ No newline at end of file
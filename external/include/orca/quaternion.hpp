@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <stdexcept>
 
+#include "simd.hpp"
 #include "vector.hpp"
 #include "vector_functions.hpp"
 
@@ -28,7 +29,7 @@ namespace orca
     /*  CLASS NAME: quaternion  */
     /****************************/
     template<typename T>
-    class quaternion
+    class alignas(simd_alignment<T>::value) quaternion
     {
     private:
         using element_type = T;
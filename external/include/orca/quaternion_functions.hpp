@@ -50,6 +50,18 @@ namespace orca
         return result;
     }
 
+    /* return normalized quaternion (a zero quaternion is returned as is) */
+    template<typename T>
+    inline quaternion<T> Normalize(const quaternion<T>& quat)
+    {
+        T squared = static_cast<T>(0.0);
+        for(unsigned int i = 0; i < quat.Size(); ++i)
+            squared += quat.data[i] * quat.data[i];
+        if(squared <= std::numeric_limits<T>::min())
+            return quat;
+        return quat * (static_cast<T>(1.0) / std::sqrt(squared));
+    }
+
     /* return quaternion inverse */
     template<typename T>
     inline quaternion<T> Inverse(const quaternion<T>& quat)
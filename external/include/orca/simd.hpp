@@ -0,0 +1,65 @@
+/*************************/
+/*  FILE NAME: simd.hpp  */
+/*************************/
+#ifndef _ORCA_SIMD_HPP_
+#define _ORCA_SIMD_HPP_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstddef>
+
+/* instruction set selection                                              */
+/* ORCA_SIMD_AVX2 implies ORCA_SIMD_SSE2. define ORCA_NO_SIMD to build the */
+/* generic scalar code only.                                              */
+#if !defined(ORCA_NO_SIMD)
+    #if defined(__AVX2__)
+        #define ORCA_SIMD_AVX2
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define ORCA_SIMD_SSE2
+    #endif
+#endif
+
+#if defined(ORCA_SIMD_AVX2)
+    #include <immintrin.h>
+#elif defined(ORCA_SIMD_SSE2)
+    #include <emmintrin.h>
+#endif
+
+namespace orca
+{
+    /* storage alignment of vec4<T> and quaternion<T> */
+    template<typename T>
+    struct simd_alignment
+    {
+        static constexpr std::size_t value = alignof(T);
+    };
+
+    template<>
+    struct simd_alignment<float>
+    {
+        static constexpr std::size_t value = 16;
+    };
+
+#if defined(ORCA_SIMD_SSE2)
+    namespace simd
+    {
+        /* returns x + y + z + w in lane 0, added left to right like the scalar loops */
+        inline __m128 SumInOrder(__m128 v)
+        {
+            __m128 sum = _mm_add_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+            sum = _mm_add_ss(sum, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+            sum = _mm_add_ss(sum, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+            return sum;
+        }
+
+        /* selects 'a' in the lanes where 'mask' is set and 'b' elsewhere */
+        inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+    } // namespace simd
+#endif
+} // namespace orca
+#endif // !_ORCA_SIMD_HPP_
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <limits>
 
+#include "simd.hpp"
 #include "vector.hpp"
 
 namespace orca
@@ -24,7 +25,7 @@ namespace orca
     /*  CLASS NAME: vec4  */
     /**********************/
     template<typename T>
-    class vec4
+    class alignas(simd_alignment<T>::value) vec4
     {
     private:
         using element_type = T;
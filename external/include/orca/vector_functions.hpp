@@ -12,6 +12,7 @@
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
+#include "simd.hpp"
 #include "vector.hpp"
 
 namespace orca
@@ -291,5 +292,27 @@ namespace orca
         return ((start * std::cos(theta)) + (relative_vec * std::sin(theta)));
     }
 
+#if defined(ORCA_SIMD_SSE2)
+    /* returns the spherical linear interpolation of two vec4<float> using SSE2 */
+    template<>
+    inline vec4<float> Slerp(const vec4<float>& start, const vec4<float>& end, float percent)
+    {
+        const __m128 s = _mm_load_ps(start.data);
+        const __m128 e = _mm_load_ps(end.data);
+        const float dot = std::clamp(_mm_cvtss_f32(simd::SumInOrder(_mm_mul_ps(s, e))), -1.0f, 1.0f);
+        const float theta = std::acos(dot) * percent;
+
+        vec4<float> relative_vec;
+        _mm_store_ps(relative_vec.data, _mm_sub_ps(e, _mm_mul_ps(s, _mm_set1_ps(dot))));
+        relative_vec = Normalize(relative_vec);
+
+        const __m128 a = _mm_mul_ps(s, _mm_set1_ps(std::cos(theta)));
+        const __m128 b = _mm_mul_ps(_mm_load_ps(relative_vec.data), _mm_set1_ps(std::sin(theta)));
+        vec4<float> result;
+        _mm_store_ps(result.data, _mm_add_ps(a, b));
+        return result;
+    }
+#endif
+
 } // namespace orca
 #endif // !_ORCA_VECTOR_FUNCTIONS_HPP_
\ No newline at end of file
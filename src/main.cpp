@@ -13,6 +13,20 @@
  * you can adjust the moving speed with the Q and E keys.
  * you can rotate the mouse by moving it.
  * you can zoom using the scroll of the mouse.
+ * pass '--dual-quaternion' after the file to skin with dual quaternions (rigid joints only).
+ * pass '--crowd <count>' after the file to draw that many instances with baked animations.
+ * pass '--indirect' after the file to draw the meshes with multi-draw indirect commands.
+ * pass '--headless' after the file to render offscreen through EGL (no window, no vsync) and print
+ * the frame times, for '--frames <count>' frames (600 by default) or '--duration <seconds>'.
+ * pass '--pipelined' after the file to update the animation on its own thread, one frame ahead of the render.
+ * press P to start and stop a profile, written as a Chrome trace (chrome://tracing, ui.perfetto.dev) to
+ * 'profile_trace.json'. pass '--profile <file>' after the file to profile from the start (loading included)
+ * to the exit into that file, and '--profile-gpu' to add the GPU times of the draws.
+ * press M to print the CPU and GPU memory of the model by category (printed at the end of a headless run too).
+ * pass '--release-cpu-data' after the file to load the model without the CPU copies of the vertices and indices
+ * (freed once uploaded).
+ * a headless run prints the heap allocations of the updates and the renders after a few warm-up frames, pass
+ * '--expect-no-alloc' to fail if there are any (a profile capture allocates its events, do not combine them).
  * 
  * Build environment
  * Windows10, gcc, x64, std=c++17
@@ -30,13 +44,20 @@
 /**************/
 /*  INCLUDES  */
 /**************/
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 #include <memory>
+#include <cstring>
 #include <string>
 #include <sstream>
 #include <fstream>
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
+#include <condition_variable>
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -45,18 +66,40 @@
 #include "Mouse/mouse.h"
 #include "Camera/camera.h"
 #include "Shader/shader.h"
+#include "Shader/program_cache.h"
+#include "Profiler/profiler.h"
+#include "Profiler/alloc_tracker.h"
+#include "Renderer/gl_state.h"
+#include "Renderer/gpu_timer.h"
+#include "Renderer/upload_ring.h"
+#include "Renderer/frame_times.h"
+#include "Renderer/offscreen_target.h"
+#include "Renderer/headless_context.h"
 #include "Keyboard/keyboard.h"
 
 /***************/
 /*  CONSTANTS  */
 /***************/
-constexpr char* ANIM_VERT_SHADER = "/GLSL/anim_vert.glsl";
-constexpr char* ANIM_FRAG_SHADER = "/GLSL/anim_frag.glsl";
-constexpr char* DEF_VERT_SHADER = "/GLSL/def_vert.glsl";
-constexpr char* DEF_FRAG_SHADER = "/GLSL/def_frag.glsl";
-constexpr char* TITLE = "glTF Animation Application";
+constexpr const char* ANIM_VERT_SHADER = "/GLSL/anim_vert.glsl";
+constexpr const char* ANIM_FRAG_SHADER = "/GLSL/anim_frag.glsl";
+constexpr const char* ANIM_DQ_VERT_SHADER = "/GLSL/anim_dq_vert.glsl";
+constexpr const char* ANIM_CROWD_VERT_SHADER = "/GLSL/anim_crowd_vert.glsl";
+constexpr const char* ANIM_MDI_VERT_SHADER = "/GLSL/anim_mdi_vert.glsl";
+constexpr const char* DEF_VERT_SHADER = "/GLSL/def_vert.glsl";
+constexpr const char* DEF_FRAG_SHADER = "/GLSL/def_frag.glsl";
+constexpr const char* PROGRAM_CACHE_DIR = "/shader_cache";
+constexpr const char* PROFILE_FILE = "profile_trace.json";
+constexpr const char* TITLE = "glTF Animation Application";
 constexpr int WIDTH = 1280;
 constexpr int HEIGHT = 720;
+constexpr unsigned int CAMERA_BLOCK_BINDING = 0;
+constexpr std::size_t UPLOAD_RING_FRAME_SIZE = 4 * 1024 * 1024;
+constexpr std::size_t TEXTURE_STREAM_BUDGET = 2 * 1024 * 1024;
+constexpr float CROWD_FRAMES_PER_SECOND = 30.0f;
+constexpr float CROWD_SPACING = 2.0f;
+constexpr std::size_t HEADLESS_FRAMES = 600;
+constexpr double HEADLESS_DELTA_TIME = 1.0 / 60.0;
+constexpr std::size_t HEADLESS_WARMUP_FRAMES = 10;
 
 /*************/
 /*  GLOBALS  */
@@ -68,11 +111,46 @@ Mouse mouse;
 
 Shader* curr_shader;
 std::unique_ptr<Shader> anim_shader;
+std::unique_ptr<Shader> anim_dq_shader;
+std::unique_ptr<Shader> anim_crowd_shader;
+std::unique_ptr<Shader> anim_mdi_shader;
+bool indirect = false;
 std::unique_ptr<Shader> def_shader;
-int projection_location;
-int view_location;
+std::unique_ptr<ProgramCache> program_cache;
+bool use_program_cache = true;
+std::unique_ptr<UploadRing> upload_ring;
+std::size_t uniform_buffer_alignment = 256;
 
 std::unique_ptr<Model> model;
+std::unique_ptr<Crowd> crowd;
+bool release_cpu_data = false;
+
+bool headless = false;
+std::size_t headless_frames = 0;
+double headless_duration = 0.0;
+std::unique_ptr<HeadlessContext> headless_context;
+std::unique_ptr<OffscreenTarget> offscreen_target;
+
+// the heap allocations of the updates, counted once the headless run is warmed up
+bool expect_no_alloc = false;
+std::atomic<bool> count_update_allocations(false);
+std::atomic<std::size_t> update_allocations(0);
+
+// the profile is captured between two presses of P, or from the start with '--profile'
+std::string profile_file = PROFILE_FILE;
+bool profile_on_start = false;
+bool profile_gpu = false;
+std::unique_ptr<GpuTimer> gpu_timer;
+
+// the render thread draws the newest pose snapshot, written by the update thread when pipelined
+bool pipelined = false;
+PoseExchange pose_exchange;
+std::thread update_thread;
+std::mutex update_mutex;
+std::condition_variable update_condition;
+bool update_running = false;
+bool update_requested = false;
+std::exception_ptr update_error;
 
 std::string program_dir;
 std::string program_name;
@@ -83,12 +161,26 @@ std::string model_name;
 /*  FUNCTION PROTOTYPES  */
 /*************************/
 void initialize(int, char**);
+void initializeWindow();
 void cleanup();
 void run();
+void runHeadless();
+void printInformation();
+void printMemoryUsage();
 
 void inputHandling();
 void update(double delta_time);
-void render();
+void updateAnimation(double delta_time);
+void render(const PoseSnapshot& pose);
+
+void startUpdateThread(double fixed_delta_time);
+void stopUpdateThread();
+void updateLoop(double fixed_delta_time);
+const PoseSnapshot& acquirePose();
+double currentTime();
+
+void startProfile();
+void stopProfile();
 
 void getFileDirAndName(const std::string&, std::string*, std::string*);
 
@@ -105,7 +197,10 @@ int main(int argc, char* argv[])
     try
     {
         initialize(argc, argv);
-        run();
+        if (headless)
+            runHeadless();
+        else
+            run();
         cleanup();
         return EXIT_SUCCESS;
     }
@@ -120,13 +215,167 @@ int main(int argc, char* argv[])
 
 void initialize(int argc, char** argv)
 {
-    if (argc != 2)
-        throw std::runtime_error("Usage: " + std::string(argv[0]) + " <glTF File>");
+    const std::string usage = "Usage: " + std::string(argv[0]) + " <glTF File> [--dual-quaternion] [--crowd <count>] [--indirect] [--pipelined] [--no-shader-cache]"
+                            + " [--headless [--frames <count>] [--duration <seconds>]] [--profile <file>] [--profile-gpu] [--release-cpu-data] [--expect-no-alloc]";
+    if (argc < 2)
+        throw std::runtime_error(usage);
+
+    bool dual_quaternion = false;
+    int crowd_size = 0;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--dual-quaternion")
+            dual_quaternion = true;
+        else if (std::string(argv[i]) == "--indirect")
+            indirect = true;
+        else if (std::string(argv[i]) == "--crowd" && i + 1 < argc)
+            crowd_size = std::max(std::stoi(argv[++i]), 0);
+        else if (std::string(argv[i]) == "--pipelined")
+            pipelined = true;
+        else if (std::string(argv[i]) == "--no-shader-cache")
+            use_program_cache = false;
+        else if (std::string(argv[i]) == "--headless")
+            headless = true;
+        else if (std::string(argv[i]) == "--frames" && i + 1 < argc)
+            headless_frames = static_cast<std::size_t>(std::max(std::stoi(argv[++i]), 0));
+        else if (std::string(argv[i]) == "--duration" && i + 1 < argc)
+            headless_duration = std::max(std::stod(argv[++i]), 0.0);
+        else if (std::string(argv[i]) == "--profile" && i + 1 < argc)
+        {
+            profile_file = argv[++i];
+            profile_on_start = true;
+        }
+        else if (std::string(argv[i]) == "--profile-gpu")
+            profile_gpu = true;
+        else if (std::string(argv[i]) == "--release-cpu-data")
+            release_cpu_data = true;
+        else if (std::string(argv[i]) == "--expect-no-alloc")
+            expect_no_alloc = true;
+        else
+            throw std::runtime_error(usage);
+    }
+
+    Profiler::Get().SetThreadName("main");
+    if (profile_on_start)
+        startProfile();
 
     getFileDirAndName(argv[0], &program_dir, &program_name);
     getFileDirAndName(argv[1], &model_dir, &model_name);
 
+    if (headless)
+    {
+        // an EGL context and a framebuffer object stand in for the window
+        headless_context = std::make_unique<HeadlessContext>();
+        headless_context->SetupContext(3, 3);
+
+        // GLEW built for GLX fails to find a GLX display after loading the core entry points
+        glewExperimental = GL_TRUE;
+        const GLenum result = glewInit();
+        if (result != GLEW_OK && result != GLEW_ERROR_NO_GLX_DISPLAY)
+            throw std::runtime_error("Failed to initialize GLEW.");
+
+        offscreen_target = std::make_unique<OffscreenTarget>();
+        offscreen_target->SetupTarget(WIDTH, HEIGHT);
+        offscreen_target->Bind();
+    }
+    else
+        initializeWindow();
+
+    if (profile_gpu)
+    {
+        gpu_timer = std::make_unique<GpuTimer>();
+        gpu_timer->SetupTimer();
+        if (!gpu_timer->IsSupported())
+            std::cout << "Timer queries are not supported, the profile has no GPU times." << std::endl;
+    }
+
+
+    std::cout << "Model Loading...";
+    AssetLoadOptions load_options;
+    load_options.release_cpu_data = release_cpu_data;
+    model = std::make_unique<Model>(ModelAsset::Load(model_dir + '/' + model_name, load_options));
+    std::cout << "Success!" << std::endl;
+    std::cout << std::endl;
+
+    // linked programs are kept as driver binaries, the next launch skips compiling them
+    if (use_program_cache)
+        program_cache = std::make_unique<ProgramCache>(program_dir + PROGRAM_CACHE_DIR);
+
+    ProgramCache* cache = program_cache.get();
+    def_shader = std::make_unique<Shader>(program_dir + DEF_VERT_SHADER, program_dir + DEF_FRAG_SHADER, cache);
+    anim_shader = std::make_unique<Shader>(program_dir + ANIM_VERT_SHADER, program_dir + ANIM_FRAG_SHADER, cache);
+    anim_dq_shader = std::make_unique<Shader>(program_dir + ANIM_DQ_VERT_SHADER, program_dir + ANIM_FRAG_SHADER, cache);
+    anim_crowd_shader = std::make_unique<Shader>(program_dir + ANIM_CROWD_VERT_SHADER, program_dir + ANIM_FRAG_SHADER, cache);
+    anim_mdi_shader = std::make_unique<Shader>(program_dir + ANIM_MDI_VERT_SHADER, program_dir + ANIM_FRAG_SHADER, cache);
+    if (program_cache)
+    {
+        std::cout << "Shader Program Cache: " << program_cache->report() << std::endl;
+        std::cout << std::endl;
+    }
+
+    // select the shader variant that matches the skinning of the model
+    if (dual_quaternion && model->IsAnimated())
+    {
+        model->SetSkinningType(SKINNING_TYPE::DUAL_QUATERNION);
+        if (model->GetSkinningType() != SKINNING_TYPE::DUAL_QUATERNION)
+            std::cout << "The joints of the model are scaled, linear skinning is used." << std::endl;
+    }
+
+    if (model->GetSkinningType() == SKINNING_TYPE::DUAL_QUATERNION)
+        curr_shader = anim_dq_shader.get();
+    else if (model->GetSkinningType() == SKINNING_TYPE::LINEAR)
+        curr_shader = indirect ? anim_mdi_shader.get() : anim_shader.get();
+    else
+        curr_shader = def_shader.get();
+
+    // the indirect variant reads the joint offset per draw, there is none for dual quaternions
+    if (indirect && model->GetSkinningType() == SKINNING_TYPE::DUAL_QUATERNION)
+    {
+        std::cout << "Multi-draw indirect does not support dual quaternion skinning, the meshes are drawn one by one." << std::endl;
+        indirect = false;
+    }
+
+    // bake every animation once and lay the instances out on a square grid
+    if (crowd_size > 0 && model->IsAnimated())
+    {
+        crowd = std::make_unique<Crowd>();
+        crowd->SetupCrowd();
+        model->BakeAnimations(*crowd, CROWD_FRAMES_PER_SECOND);
+
+        const int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(crowd_size))));
+        for (int i = 0; i < crowd_size; ++i)
+        {
+            orca::affine<float> transform;
+            transform.data[0].w = CROWD_SPACING * static_cast<float>(i % columns);
+            transform.data[2].w = CROWD_SPACING * static_cast<float>(i / columns);
+            crowd->AddInstance(transform, i % static_cast<int>(crowd->NumClips()), 0.37f * static_cast<float>(i));
+        }
+        curr_shader = anim_crowd_shader.get();
+    }
+    else if (crowd_size > 0)
+        std::cout << "The model is not animated, the crowd is not drawn." << std::endl;
+
+    // per-frame data (camera block, joint palette) is written into a triple-buffered persistently mapped ring
+    upload_ring = std::make_unique<UploadRing>();
+    upload_ring->SetupRing(UPLOAD_RING_FRAME_SIZE);
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    uniform_buffer_alignment = std::max<std::size_t>(static_cast<std::size_t>(alignment), 1);
 
+    // the camera block of every program reads the same range of the ring
+    def_shader->bindUniformBlock("Camera", CAMERA_BLOCK_BINDING);
+    anim_shader->bindUniformBlock("Camera", CAMERA_BLOCK_BINDING);
+    anim_dq_shader->bindUniformBlock("Camera", CAMERA_BLOCK_BINDING);
+    anim_crowd_shader->bindUniformBlock("Camera", CAMERA_BLOCK_BINDING);
+    anim_mdi_shader->bindUniformBlock("Camera", CAMERA_BLOCK_BINDING);
+
+
+    glEnable(GL_DEPTH_TEST);
+}
+
+// this function creates the window, its OpenGL context and loads the entry points
+void initializeWindow()
+{
     // set GLFW error callback function 
     glfwSetErrorCallback(errorCallback);
 
@@ -158,36 +407,35 @@ void initialize(int argc, char** argv)
     glewExperimental = GL_TRUE;
     if (glewInit() != GLEW_OK)
         throw std::runtime_error("Failed to initialize GLEW.");
-
-
-
-    std::cout << "Model Loading...";
-    model = std::make_unique<Model>(model_dir, model_name);
-    std::cout << "Success!" << std::endl;
-    std::cout << std::endl;
-
-    def_shader = std::make_unique<Shader>(program_dir + DEF_VERT_SHADER, program_dir + DEF_FRAG_SHADER);
-    anim_shader = std::make_unique<Shader>(program_dir + ANIM_VERT_SHADER, program_dir + ANIM_FRAG_SHADER);
-
-    curr_shader = model->IsAnimated() ? anim_shader.get() : def_shader.get();
-    projection_location = glGetUniformLocation(curr_shader->get(), "projection");
-    view_location = glGetUniformLocation(curr_shader->get(), "view");
-
-
-    glEnable(GL_DEPTH_TEST);
 }
 
 void cleanup()
 {
+    stopUpdateThread();
+    if (Profiler::Get().IsCapturing())
+        stopProfile();
+    gpu_timer.reset();
+    if (crowd)
+        crowd->CleanupCrowd();
+    crowd.reset();
+    upload_ring.reset();
+    anim_crowd_shader.reset();
+    anim_mdi_shader.reset();
+    anim_dq_shader.reset();
     anim_shader.reset();
     def_shader.reset();
+    program_cache.reset();
     model.reset();
 
-    glfwDestroyWindow(window);
+    offscreen_target.reset();
+    headless_context.reset();
+    if (window)
+        glfwDestroyWindow(window);
     glfwTerminate();
 }
 
-void run()
+// this function prints the files and the OpenGL implementation in use
+void printInformation()
 {
     std::cout << "[File Infomation]" << std::endl;
     std::cout << "Program Directory: " << program_dir << std::endl;
@@ -202,23 +450,178 @@ void run()
     std::cout << "Vendor: " << glGetString(GL_VENDOR) << std::endl;
     std::cout << "Renderer: " << glGetString(GL_RENDERER) << std::endl;
     std::cout << std::endl;
+}
+
+void run()
+{
+    printInformation();
 
     double prev_time;
     double curr_time;
     double delta_time;
     double frame_late;
 
+    // frame statistics shown in the window title once a second
+    double stats_time;
+    std::size_t stats_frames = 0;
+    std::size_t stats_uploaded_bytes = 0;
+    double stats_latency = 0.0;
+
+    startUpdateThread(0.0);
     prev_time = glfwGetTime();
+    stats_time = prev_time;
     while (!glfwWindowShouldClose(window))
     {
+        PROFILE_ZONE("frame", "frame");
         curr_time = glfwGetTime();
         delta_time = curr_time - prev_time;
         frame_late = 1.0 / delta_time;
         prev_time = curr_time;
 
+        GLState::Get().ResetStats();
+        if (gpu_timer)
+            gpu_timer->Collect(false);
+
         inputHandling();
+        upload_ring->BeginFrame();
+        if (!pipelined)
+            updateAnimation(delta_time);
+        model->StreamTextures(*upload_ring, TEXTURE_STREAM_BUDGET);
+        const PoseSnapshot& pose = acquirePose();
         update(delta_time);
-        render();
+        render(pose);
+        upload_ring->EndFrame();
+        glfwSwapBuffers(window);
+        stats_latency += currentTime() - pose.update_start;
+
+        // compare the cached bindings with the driver (on by default in debug builds)
+        if (GLState::Get().IsValidation())
+            GLState::Get().Validate();
+
+        stats_frames += 1;
+        stats_uploaded_bytes += model->GetUploadedBytes();
+        if (curr_time - stats_time >= 1.0)
+        {
+            std::ostringstream title;
+            title << TITLE << " | " << static_cast<int>(stats_frames / (curr_time - stats_time)) << " fps"
+                  << " | " << (pipelined ? "pipelined" : "serial") << " latency " << 1000.0 * stats_latency / stats_frames << " ms"
+                  << " | textures " << model->GetStreamingTextures() << " streaming"
+                  << " | joint palette " << stats_uploaded_bytes / stats_frames << " bytes/frame"
+                  << " | upload ring " << (upload_ring->IsPersistent() ? "mapped" : "staged") << ", "
+                  << upload_ring->Stalls() << " stalls"
+                  << " | " << model->GetRenderStats().draw_calls << " draws ("
+                  << model->GetRenderStats().instances << " instances, "
+                  << model->GetCulledMeshes() << " culled), "
+                  << model->GetRenderStats().StateChanges() << " state changes ("
+                  << model->GetRenderStats().elided_changes << " elided)"
+                  << " | GL binds " << GLState::Get().GetStats().Issued() << " issued, "
+                  << GLState::Get().GetStats().Skipped() << " skipped";
+            glfwSetWindowTitle(window, title.str().c_str());
+            stats_time = curr_time;
+            stats_frames = 0;
+            stats_uploaded_bytes = 0;
+            stats_latency = 0.0;
+        }
+    }
+}
+
+// this function prints the CPU and GPU bytes of the model and the crowd by category
+void printMemoryUsage()
+{
+    MemoryUsage total = model->GetMemoryUsage();
+    std::cout << "[Memory]" << std::endl;
+    std::cout << "Model: " << model_name << std::endl;
+    std::cout << total.Report();
+    if (crowd)
+    {
+        const MemoryUsage crowd_usage = crowd->GetMemoryUsage();
+        std::cout << "Crowd: " << crowd->Size() << " instances" << std::endl;
+        std::cout << crowd_usage.Report();
+        total += crowd_usage;
+        std::cout << "Total: " << total.TotalCpu() / 1024 << " KiB cpu, " << total.TotalGpu() / 1024 << " KiB gpu" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+// this function renders a fixed number of frames or for a fixed time and prints the frame times.
+// every frame advances the animation by the same step, so runs are reproducible, and ends with
+// glFinish, so the render time holds the submission and the GPU (or software rasterizer) work.
+// the update time is the one of the update that wrote the drawn pose, the latency runs from the
+// start of that update to the end of the frame. after HEADLESS_WARMUP_FRAMES frames (the scratch
+// memory of the frame has grown to its size by then) the heap allocations of the updates and the
+// renders are counted, a frame of the steady state should make none.
+void runHeadless()
+{
+    printInformation();
+    startUpdateThread(HEADLESS_DELTA_TIME);
+
+    using Clock = std::chrono::steady_clock;
+    auto milliseconds = [](Clock::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); };
+
+    const std::size_t max_frames = (headless_frames == 0 && headless_duration <= 0.0) ? HEADLESS_FRAMES : headless_frames;
+    FrameTimes frame_times;
+    frame_times.Reserve(max_frames);
+
+    const Clock::time_point start_time = Clock::now();
+    Clock::time_point curr_time = start_time;
+    std::size_t texture_frames = 0;
+    std::size_t render_allocations = 0;
+    while ((max_frames == 0 || frame_times.Size() < max_frames)
+        && (headless_duration <= 0.0 || milliseconds(curr_time - start_time) < headless_duration * 1000.0))
+    {
+        PROFILE_ZONE("frame", "frame");
+        GLState::Get().ResetStats();
+        if (gpu_timer)
+            gpu_timer->Collect(false);
+
+        upload_ring->BeginFrame();
+        if (!pipelined)
+            updateAnimation(HEADLESS_DELTA_TIME);
+        const Clock::time_point render_time = Clock::now();
+        if (model->StreamTextures(*upload_ring, TEXTURE_STREAM_BUDGET) > 0)
+            texture_frames = frame_times.Size() + 1;
+        const PoseSnapshot& pose = acquirePose();
+        update(HEADLESS_DELTA_TIME);
+        if (frame_times.Size() == HEADLESS_WARMUP_FRAMES)
+            count_update_allocations = true;
+        const AllocationScope render_scope;
+        render(pose);
+        if (frame_times.Size() >= HEADLESS_WARMUP_FRAMES)
+            render_allocations += render_scope.Counts().allocations;
+        upload_ring->EndFrame();
+        glFinish();
+        curr_time = Clock::now();
+
+        if (GLState::Get().IsValidation())
+            GLState::Get().Validate();
+
+        frame_times.Add(pose.update_time, milliseconds(curr_time - render_time), (currentTime() - pose.update_start) * 1000.0);
+    }
+    stopUpdateThread();
+
+    const double elapsed_time = milliseconds(curr_time - start_time) / 1000.0;
+    std::cout << "[Frame Times]" << std::endl;
+    std::cout << "Frames: " << frame_times.Size() << " in " << elapsed_time << " s ("
+              << static_cast<double>(frame_times.Size()) / std::max(elapsed_time, 1e-9) << " fps), "
+              << (pipelined ? "pipelined" : "serial") << " update" << std::endl;
+    std::cout << "Textures: streamed in " << texture_frames << " frames, " << model->GetStreamingTextures() << " not done" << std::endl;
+    std::cout << "Poses: " << pose_exchange.Published() << " published, " << pose_exchange.Reused() << " frames drew the previous pose" << std::endl;
+    std::cout << "Draws: " << model->GetRenderStats().draw_calls << " (" << model->GetRenderStats().instances << " instances, "
+              << model->GetCulledMeshes() << " culled), GL binds " << GLState::Get().GetStats().Issued() << " per frame" << std::endl;
+    std::cout << "Upload ring: " << (upload_ring->IsPersistent() ? "mapped" : "staged") << ", " << upload_ring->FrameNumber() << " frames, "
+              << upload_ring->FenceWaits() << " fences waited on, " << upload_ring->Stalls() << " stalls" << std::endl;
+    if (AllocationTracker::IsEnabled())
+        std::cout << "Allocations: " << update_allocations << " in the updates, " << render_allocations << " in the renders (after "
+                  << HEADLESS_WARMUP_FRAMES << " warm-up frames)" << std::endl;
+    std::cout << frame_times.Report() << std::endl;
+    printMemoryUsage();
+
+    if (expect_no_alloc)
+    {
+        if (AllocationTracker::IsEnabled() == false)
+            throw std::runtime_error("--expect-no-alloc needs a build with GLTF_ANIMATION_ALLOCATION_TRACKER");
+        if (update_allocations > 0 || render_allocations > 0)
+            throw std::runtime_error("the frames of the steady state allocated on the heap");
     }
 }
 
@@ -230,9 +633,11 @@ void inputHandling()
         glfwSetWindowShouldClose(window, GLFW_TRUE);
 }
 
+// this function moves the camera and the crowd clock, it runs on the render thread
 void update(double delta_time)
 {
-    model->Update(delta_time);
+    if (crowd)
+        crowd->Update(delta_time);
 
     camera.speed += 1.0 * keyboard.isKeyDown(KEY_E);
     camera.speed -= 1.0 * keyboard.isKeyDown(KEY_Q);
@@ -250,23 +655,153 @@ void update(double delta_time)
     camera.pos += up * velocity * keyboard.isKeyDown(KEY_SPACE);
     camera.pos -= up * velocity * keyboard.isKeyDown(KEY_LEFT_SHIFT);
 
-    glUseProgram(curr_shader->get());
-    glUniformMatrix4fv(projection_location, 1, GL_FALSE, camera.getProjectionMatrix(WIDTH, HEIGHT));
-    glUniformMatrix4fv(view_location, 1, GL_FALSE, camera.getViewMatrix());
-    glUseProgram(NULL);
+    // std140 'Camera' block: mat4 projection, mat4 view
+    const orca::mat4f camera_matrices[2] = { camera.getProjectionMatrix(WIDTH, HEIGHT), camera.getViewMatrix() };
+    const UploadAllocation allocation = upload_ring->Allocate(sizeof(camera_matrices), uniform_buffer_alignment);
+    std::memcpy(allocation.data, camera_matrices, sizeof(camera_matrices));
+    upload_ring->Flush();
+    GLState::Get().BindBufferRange(GL_UNIFORM_BUFFER, CAMERA_BLOCK_BINDING, upload_ring->GetBuffer(), allocation.offset, allocation.size);
     
 }
 
-void render()
+// this function animates the model and publishes its pose, on the update thread when pipelined
+void updateAnimation(double delta_time)
 {
+    PoseSnapshot& pose = pose_exchange.Back();
+    pose.update_start = currentTime();
+    const AllocationScope allocation_scope;
+    model->Update(delta_time);
+    model->WriteSnapshot(pose);
+    if (count_update_allocations)
+        update_allocations += allocation_scope.Counts().allocations;
+    pose.update_time = (currentTime() - pose.update_start) * 1000.0;
+    pose_exchange.Publish();
+}
+
+void render(const PoseSnapshot& pose)
+{
+    GpuZone gpu_zone(gpu_timer.get(), "render");
     glClearColor(0.3f, 0.3f, 0.3f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
-    glUseProgram(curr_shader->get());
-    model->Render(curr_shader->get());
-    glUseProgram(NULL);
+    GLState::Get().UseProgram(curr_shader->get());
+    if (crowd)
+        model->RenderCrowd(*curr_shader, *crowd);
+    else
+    {
+        model->Cull(MakeFrustum(camera.getViewMatrix() * camera.getProjectionMatrix(WIDTH, HEIGHT)), pose);
+        if (indirect)
+            model->RenderIndirect(*curr_shader, *upload_ring, pose);
+        else
+            model->Render(*curr_shader, *upload_ring, pose);
+    }
+}
+
+// this function publishes the first pose and, when pipelined, starts the update thread.
+// a 'fixed_delta_time' of 0 advances the animation by the time between two updates.
+void startUpdateThread(double fixed_delta_time)
+{
+    updateAnimation(0.0);
+    if (!pipelined)
+        return;
+
+    update_running = true;
+    update_requested = true;
+    update_thread = std::thread(updateLoop, fixed_delta_time);
+}
+
+void stopUpdateThread()
+{
+    if (!update_thread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(update_mutex);
+        update_running = false;
+    }
+    update_condition.notify_one();
+    update_thread.join();
+}
+
+// this function runs one update per frame started by the render thread, while that frame is drawn.
+// the mutex only guards the request flag, it is never held during an update.
+void updateLoop(double fixed_delta_time)
+{
+    Profiler::Get().SetThreadName("update");
+    double prev_time = currentTime();
+    try
+    {
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(update_mutex);
+                update_condition.wait(lock, [] { return update_requested || !update_running; });
+                if (!update_running)
+                    return;
+                update_requested = false;
+            }
+
+            const double curr_time = currentTime();
+            updateAnimation(fixed_delta_time > 0.0 ? fixed_delta_time : curr_time - prev_time);
+            prev_time = curr_time;
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(update_mutex);
+        update_error = std::current_exception();
+    }
+}
 
-    glfwSwapBuffers(window);
+// this function returns the newest pose without waiting and asks for the next one.
+// if the update of the previous frame is not done yet, the pose before it is drawn again.
+const PoseSnapshot& acquirePose()
+{
+    const PoseSnapshot& pose = pose_exchange.Acquire();
+    if (pipelined)
+    {
+        {
+            std::lock_guard<std::mutex> lock(update_mutex);
+            if (update_error)
+                std::rethrow_exception(update_error);
+            update_requested = true;
+        }
+        update_condition.notify_one();
+    }
+    return pose;
+}
+
+// this function returns the time of the steady clock in seconds
+double currentTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// this function drops the last profile and starts capturing a new one
+void startProfile()
+{
+    if (!Profiler::HasZones())
+        std::cout << "The profiler zones are compiled out (GLTF_ANIMATION_PROFILER), only GPU times are captured." << std::endl;
+    Profiler::Get().Start();
+    std::cout << "Profile: capturing..." << std::endl;
+}
+
+// this function stops capturing and writes the profile as a Chrome trace, a failed write is only reported
+void stopProfile()
+{
+    if (gpu_timer)
+        gpu_timer->Collect(true);
+    Profiler::Get().Stop();
+    try
+    {
+        Profiler::Get().WriteTrace(profile_file);
+        std::cout << "Profile: " << Profiler::Get().NumEvents() << " events (" << Profiler::Get().NumDropped()
+                  << " dropped) written to " << profile_file << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[ERROR] " << e.what() << std::endl;
+    }
 }
 
 // this function gets the directory and the name of a file from a string
@@ -339,6 +874,20 @@ static void keyboardCallback(GLFWwindow* window, int key, int scan_code, int act
         keyboard.keyDown(KEY_SPACE);
     else if (key == GLFW_KEY_SPACE && action == GLFW_RELEASE)
         keyboard.keyUp(KEY_SPACE); 
+    else if (key == GLFW_KEY_P && action == GLFW_PRESS)
+    {
+        if (Profiler::Get().IsCapturing())
+            stopProfile();
+        else
+            startProfile();
+    }
+    else if (key == GLFW_KEY_M && action == GLFW_PRESS)
+    {
+        // the animation state is measured with the update thread stopped
+        stopUpdateThread();
+        printMemoryUsage();
+        startUpdateThread(0.0);
+    }
 }
 
 // this function executes whenever the mouse moves
@@ -7,6 +7,9 @@
 /*  INCLUDES  */
 /**************/
 #include <limits>
+#include <utility>
+#include <algorithm>
+#include <vector_functions.hpp>
 
 /* default constructor */
 Animation::Animation()
@@ -27,4 +30,64 @@ Animation::Animation(const Animation& other)
     , channels(other.channels)
     , start_time(other.start_time)
     , end_time(other.end_time)
-{ /* empty */ }
\ No newline at end of file
+{ /* empty */ }
+
+/* move constructor */
+Animation::Animation(Animation&& other) noexcept
+    : name(std::move(other.name))
+    , samplers(std::move(other.samplers))
+    , channels(std::move(other.channels))
+    , start_time(other.start_time)
+    , end_time(other.end_time)
+{ /* empty */ }
+
+
+/* function to set the nodes animated by 'animation' to their keys at 'time' */
+/* returns true if a node was changed                                        */
+/* (Scene::Update() samples the current animation with it every frame)       */
+bool SampleAnimation(const Animation& animation, float time, std::map<int, Node>& nodes)
+{
+    bool updated = false;
+    for (const auto& channel : animation.channels)
+    {
+        const AnimationSampler& sampler = animation.samplers[channel.sampler_id];
+        if(sampler.inputs.size() > sampler.outputs.size())
+            continue;
+
+        
+        for(std::size_t i = 0; i < sampler.inputs.size() - 1; ++i)
+        {
+            if((time >= sampler.inputs[i]) && (time <= sampler.inputs[i + 1]))
+            {
+                float u = std::max(0.0f, time - sampler.inputs[i]) / (sampler.inputs[i + 1] - sampler.inputs[i]);
+                if(u <= 1.0f)
+                {
+                    /* NOTE: use the previous sampler output information of the current frame              */
+                    /* TODO: interpolate the sampler output information before and after the current frame */
+                    /*       using the interpolation information stored in the sampler                     */
+                    if(channel.path_type == PATH_TYPE::TRANSLATION)
+                    {
+                        auto translation = sampler.outputs[i];
+                        // auto translation = orca::Lerp(sampler.outputs[i], sampler.outputs[i + 1], u);
+                        nodes[channel.node_id].translate = orca::vec3<float>(translation);
+                    }
+                    else if(channel.path_type == PATH_TYPE::SCALE)
+                    {
+                        auto scale = sampler.outputs[i];
+                        // auto scale = orca::Lerp(sampler.outputs[i], sampler.outputs[i + 1], u);
+                        nodes[channel.node_id].scale = orca::vec3<float>(scale);
+                    }
+                    else if(channel.path_type == PATH_TYPE::ROTATION)
+                    {
+                        auto rotation = sampler.outputs[i];
+                        // auto rotation = orca::Slerp(sampler.outputs[i], sampler.outputs[i + 1], u);
+                        nodes[channel.node_id].rotate = orca::Normalize(rotation);
+                    }
+
+                    updated = true;
+                }
+            }
+        }
+    }
+    return updated;
+}
\ No newline at end of file
@@ -8,7 +8,9 @@
 /*  INCLUDES  */
 /**************/
 #include <string>
+#include <map>
 #include <vector>
+#include "node.h"
 #include "animation_channel.h"
 #include "animation_sampler.h"
 
@@ -20,6 +22,11 @@ class Animation
 public:
     Animation();
     Animation(const Animation& other);
+    Animation(Animation&& other) noexcept;
+
+public:
+    Animation& operator=(const Animation& rhs) = default;
+    Animation& operator=(Animation&& rhs) noexcept = default;
 
 public:
     std::string name;
@@ -28,4 +35,6 @@ public:
     float start_time;
     float end_time;
 }; // class Animation
+
+bool SampleAnimation(const Animation& animation, float time, std::map<int, Node>& nodes);
 #endif // !_ANIMATION_H_
\ No newline at end of file
@@ -3,6 +3,11 @@
 /**************************************/
 #include "animation_sampler.h"
 
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <utility>
+
 /* default constructor */
 AnimationSampler::AnimationSampler()
     : interpolation()
@@ -17,4 +22,11 @@ AnimationSampler::AnimationSampler(const AnimationSampler& other)
     : interpolation(other.interpolation)
     , inputs(other.inputs)
     , outputs(other.outputs)
+{ /* empty */ }
+
+/* move constructor */
+AnimationSampler::AnimationSampler(AnimationSampler&& other) noexcept
+    : interpolation(other.interpolation)
+    , inputs(std::move(other.inputs))
+    , outputs(std::move(other.outputs))
 { /* empty */ }
\ No newline at end of file
@@ -29,6 +29,11 @@ class AnimationSampler
 public:
     AnimationSampler();
     AnimationSampler(const AnimationSampler& other);
+    AnimationSampler(AnimationSampler&& other) noexcept;
+
+public:
+    AnimationSampler& operator=(const AnimationSampler& rhs) = default;
+    AnimationSampler& operator=(AnimationSampler&& rhs) noexcept = default;
 
 public:
     INTERPOLATION_TYPE interpolation;
@@ -0,0 +1,35 @@
+/********************************/
+/*  FILE NAME: asset_cache.cpp  */
+/********************************/
+#include "asset_cache.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <filesystem>
+#include <system_error>
+
+/* default constructor */
+AssetLoadOptions::AssetLoadOptions()
+    : release_cpu_data(false)
+{ /* empty */ }
+
+/* copy constructor */
+AssetLoadOptions::AssetLoadOptions(const AssetLoadOptions& other)
+    : release_cpu_data(other.release_cpu_data)
+{ /* empty */ }
+
+/* function to order the options in the keys of an AssetCache */
+bool AssetLoadOptions::operator<(const AssetLoadOptions& rhs) const
+{
+    return release_cpu_data < rhs.release_cpu_data;
+}
+
+/* function to return the absolute path of 'file' with the '.', '..' and symbolic links resolved */
+/* NOTE: the part of the path that does not exist is only normalized, the load reports it       */
+std::string CanonicalAssetPath(const std::string& file)
+{
+    std::error_code error;
+    const std::filesystem::path path = std::filesystem::weakly_canonical(std::filesystem::absolute(file, error), error);
+    return (error) ? std::filesystem::path(file).lexically_normal().string() : path.string();
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+/******************************/
+/*  FILE NAME: asset_cache.h  */
+/******************************/
+#ifndef _ASSET_CACHE_H_
+#define _ASSET_CACHE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <map>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <utility>
+#include <cstddef>
+
+/**********************************/
+/*  CLASS NAME: AssetLoadOptions  */
+/**********************************/
+/* what, besides the file, makes two loads of an asset differ. loads with */
+/* the same file and options share one asset.                             */
+class AssetLoadOptions
+{
+public:
+    AssetLoadOptions();
+    AssetLoadOptions(const AssetLoadOptions& other);
+
+public:
+    bool operator<(const AssetLoadOptions& rhs) const;
+
+public:
+    bool release_cpu_data;  /* free the CPU vertices and indices once uploaded */
+}; // class AssetLoadOptions
+
+std::string CanonicalAssetPath(const std::string& file);
+
+/****************************/
+/*  CLASS NAME: AssetCache  */
+/****************************/
+/* the loaded assets of the process, one per canonical path and options.   */
+/* Load() returns a shared handle to the asset, loaded by the first call   */
+/* and by the calls made after every handle of it was dropped: the cache   */
+/* only keeps weak references, the last handle frees the asset (and its GL */
+/* objects, so it must be dropped on the GL thread). the assets are not    */
+/* changed after the load, users keep their own state next to them. loads */
+/* are serialized, two threads asking for the same file parse it once.    */
+template<typename Asset>
+class AssetCache
+{
+private:
+    AssetCache();
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+public:
+    static AssetCache& Get();
+
+public:
+    template<typename LoadFunction>
+    std::shared_ptr<Asset> Load(const std::string& file, const AssetLoadOptions& options, LoadFunction load);
+    std::size_t Purge();
+
+public:
+    std::size_t NumAssets() const;
+    std::size_t NumLoads() const;
+    std::size_t NumMisses() const;
+
+private:
+    using Key = std::pair<std::string, AssetLoadOptions>;
+
+    mutable std::mutex mutex;
+    std::map<Key, std::weak_ptr<Asset>> assets;
+    std::size_t num_loads;      /* calls of Load()                 */
+    std::size_t num_misses;     /* calls of Load() that loaded it  */
+}; // class AssetCache
+
+/* constructor */
+template<typename Asset>
+AssetCache<Asset>::AssetCache()
+    : mutex()
+    , assets()
+    , num_loads(0)
+    , num_misses(0)
+{ /* empty */ }
+
+/* function to return the cache of the assets of type 'Asset' */
+template<typename Asset>
+AssetCache<Asset>& AssetCache<Asset>::Get()
+{
+    static AssetCache cache;
+    return cache;
+}
+
+/* function to return the asset of 'file' loaded with 'options'. if no handle of  */
+/* it is alive, 'load(canonical_file, options)' loads it (a std::shared_ptr)       */
+/* NOTE: an exception of 'load' is passed on and nothing is cached                 */
+template<typename Asset>
+template<typename LoadFunction>
+std::shared_ptr<Asset> AssetCache<Asset>::Load(const std::string& file, const AssetLoadOptions& options, LoadFunction load)
+{
+    Key key(CanonicalAssetPath(file), options);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    num_loads += 1;
+    auto entry = assets.find(key);
+    if(entry != assets.end())
+    {
+        std::shared_ptr<Asset> asset = entry->second.lock();
+        if(asset != nullptr)
+            return asset;
+    }
+
+    std::shared_ptr<Asset> asset = load(key.first, options);
+    num_misses += 1;
+    assets[std::move(key)] = asset;
+    return asset;
+}
+
+/* function to forget the assets whose handles were all dropped, returns how many */
+template<typename Asset>
+std::size_t AssetCache<Asset>::Purge()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t purged = 0;
+    for(auto entry = assets.begin(); entry != assets.end();)
+    {
+        if(entry->second.expired() == true)
+        {
+            entry = assets.erase(entry);
+            purged += 1;
+        }
+        else
+            ++entry;
+    }
+    return purged;
+}
+
+/* function to return the number of assets with a handle alive */
+template<typename Asset>
+std::size_t AssetCache<Asset>::NumAssets() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t count = 0;
+    for(const auto& entry : assets)
+        count += (entry.second.expired() == false) ? 1 : 0;
+    return count;
+}
+
+template<typename Asset>
+std::size_t AssetCache<Asset>::NumLoads() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return num_loads;
+}
+
+template<typename Asset>
+std::size_t AssetCache<Asset>::NumMisses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return num_misses;
+}
+#endif // !_ASSET_CACHE_H_
\ No newline at end of file
@@ -0,0 +1,181 @@
+/***************************/
+/*  FILE NAME: bounds.cpp  */
+/***************************/
+#include "bounds.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <vector_functions.hpp>
+
+/* default constructor */
+BoundingBox::BoundingBox()
+    : min(std::numeric_limits<float>::max())
+    , max(-std::numeric_limits<float>::max())
+{ /* empty */ }
+
+/* copy constructor */
+BoundingBox::BoundingBox(const BoundingBox& other)
+    : min(other.min)
+    , max(other.max)
+{ /* empty */ }
+
+void BoundingBox::Extend(const orca::vec3<float>& point)
+{
+    min = orca::vec3<float>(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+    max = orca::vec3<float>(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+}
+
+void BoundingBox::Extend(const BoundingBox& box)
+{
+    if(box.IsEmpty() == true)
+        return;
+    Extend(box.min);
+    Extend(box.max);
+}
+
+bool BoundingBox::IsEmpty() const
+{
+    return (min.x > max.x || min.y > max.y || min.z > max.z);
+}
+
+orca::vec3<float> BoundingBox::Center() const
+{
+    return (min + max) * 0.5f;
+}
+
+/* function to return the half size of the box */
+orca::vec3<float> BoundingBox::Extents() const
+{
+    return (max - min) * 0.5f;
+}
+
+
+/* default constructor */
+BoundingSphere::BoundingSphere()
+    : center()
+    , radius(0.0f)
+{ /* empty */ }
+
+/* copy constructor */
+BoundingSphere::BoundingSphere(const BoundingSphere& other)
+    : center(other.center)
+    , radius(other.radius)
+{ /* empty */ }
+
+
+/* default constructor */
+Frustum::Frustum()
+    : planes()
+{ /* empty */ }
+
+/* copy constructor */
+Frustum::Frustum(const Frustum& other)
+    : planes()
+{
+    for(unsigned int i = 0; i < 6; ++i)
+        planes[i] = other.planes[i];
+}
+
+
+/* function to return the box that holds 'box' after 'transform' */
+/* (the center is transformed, the extents by the absolute axes) */
+BoundingBox TransformBox(const BoundingBox& box, const orca::affine<float>& transform)
+{
+    if(box.IsEmpty() == true)
+        return box;
+
+    const orca::vec3<float> center = box.Center();
+    const orca::vec3<float> extents = box.Extents();
+
+    BoundingBox result;
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+        const orca::vec4<float>& row = transform.data[i];
+        const float c = row.x * center.x + row.y * center.y + row.z * center.z + row.w;
+        const float e = std::abs(row.x) * extents.x + std::abs(row.y) * extents.y + std::abs(row.z) * extents.z;
+        result.min[i] = c - e;
+        result.max[i] = c + e;
+    }
+    return result;
+}
+
+/* function to return a box holding every skinned vertex of a mesh                 */
+/* NOTE: a linear blended vertex is a weighted mean of its joint transforms, so it */
+/*       lies in the union of the bind space boxes of its joints, transformed.     */
+/*       the vertices are never read.                                              */
+BoundingBox SkinBounds(const std::vector<BoundingBox>& joint_bounds, const std::vector<orca::affine<float>>& joint_matrices)
+{
+    BoundingBox result;
+    const std::size_t count = std::min(joint_bounds.size(), joint_matrices.size());
+    for(std::size_t i = 0; i < count; ++i)
+        result.Extend(TransformBox(joint_bounds[i], joint_matrices[i]));
+    return result;
+}
+
+/* function to return the sphere around a box */
+BoundingSphere MakeBoundingSphere(const BoundingBox& box)
+{
+    BoundingSphere sphere;
+    if(box.IsEmpty() == true)
+        return sphere;
+
+    sphere.center = box.Center();
+    sphere.radius = orca::Length(box.Extents());
+    return sphere;
+}
+
+/* function to extract the clip planes of 'view * projection'    */
+/* (row vectors: clip = p * view_projection, so the planes are   */
+/*  sums of its columns; -w <= z <= w as in OpenGL)              */
+Frustum MakeFrustum(const orca::mat4<float>& view_projection)
+{
+    const auto& m = view_projection;
+    Frustum frustum;
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+        frustum.planes[i * 2 + 0] = orca::vec4<float>(m[0][3] + m[0][i], m[1][3] + m[1][i], m[2][3] + m[2][i], m[3][3] + m[3][i]);
+        frustum.planes[i * 2 + 1] = orca::vec4<float>(m[0][3] - m[0][i], m[1][3] - m[1][i], m[2][3] - m[2][i], m[3][3] - m[3][i]);
+    }
+
+    /* normalized, so a plane equation is a distance */
+    for(auto& plane : frustum.planes)
+    {
+        const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        if(length > 0.0f)
+            plane = plane * (1.0f / length);
+    }
+    return frustum;
+}
+
+/* function to return false if the sphere is entirely outside a plane */
+bool IsVisible(const Frustum& frustum, const BoundingSphere& sphere)
+{
+    for(const auto& plane : frustum.planes)
+    {
+        if(plane.x * sphere.center.x + plane.y * sphere.center.y + plane.z * sphere.center.z + plane.w < -sphere.radius)
+            return false;
+    }
+    return true;
+}
+
+/* function to return false if the box is entirely outside a plane */
+/* (only the corner furthest along the plane normal is tested)    */
+bool IsVisible(const Frustum& frustum, const BoundingBox& box)
+{
+    if(box.IsEmpty() == true)
+        return false;
+
+    for(const auto& plane : frustum.planes)
+    {
+        const float x = (plane.x >= 0.0f) ? box.max.x : box.min.x;
+        const float y = (plane.y >= 0.0f) ? box.max.y : box.min.y;
+        const float z = (plane.z >= 0.0f) ? box.max.z : box.min.z;
+        if(plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f)
+            return false;
+    }
+    return true;
+}
\ No newline at end of file
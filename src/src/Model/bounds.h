@@ -0,0 +1,81 @@
+/*************************/
+/*  FILE NAME: bounds.h  */
+/*************************/
+#ifndef _BOUNDS_H_
+#define _BOUNDS_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <vector.hpp>
+#include <matrix.hpp>
+
+/*****************************/
+/*  CLASS NAME: BoundingBox  */
+/*****************************/
+/* axis aligned box, empty (min > max) until a point is added */
+class BoundingBox
+{
+public:
+    BoundingBox();
+    BoundingBox(const BoundingBox& other);
+
+public:
+    BoundingBox& operator=(const BoundingBox& rhs) = default;
+
+public:
+    void Extend(const orca::vec3<float>& point);
+    void Extend(const BoundingBox& box);
+    bool IsEmpty() const;
+    orca::vec3<float> Center() const;
+    orca::vec3<float> Extents() const;
+
+public:
+    orca::vec3<float> min;
+    orca::vec3<float> max;
+}; // class BoundingBox
+
+/********************************/
+/*  CLASS NAME: BoundingSphere  */
+/********************************/
+class BoundingSphere
+{
+public:
+    BoundingSphere();
+    BoundingSphere(const BoundingSphere& other);
+
+public:
+    BoundingSphere& operator=(const BoundingSphere& rhs) = default;
+
+public:
+    orca::vec3<float> center;
+    float radius;
+}; // class BoundingSphere
+
+/*************************/
+/*  CLASS NAME: Frustum  */
+/*************************/
+/* the 6 clip planes (a, b, c, d) of a view projection matrix, with  */
+/* a * x + b * y + c * z + d >= 0 on the inside (left, right, bottom, */
+/* top, near, far)                                                    */
+class Frustum
+{
+public:
+    Frustum();
+    Frustum(const Frustum& other);
+
+public:
+    Frustum& operator=(const Frustum& rhs) = default;
+
+public:
+    orca::vec4<float> planes[6];
+}; // class Frustum
+
+BoundingBox TransformBox(const BoundingBox& box, const orca::affine<float>& transform);
+BoundingBox SkinBounds(const std::vector<BoundingBox>& joint_bounds, const std::vector<orca::affine<float>>& joint_matrices);
+BoundingSphere MakeBoundingSphere(const BoundingBox& box);
+Frustum MakeFrustum(const orca::mat4<float>& view_projection);
+bool IsVisible(const Frustum& frustum, const BoundingSphere& sphere);
+bool IsVisible(const Frustum& frustum, const BoundingBox& box);
+#endif // !_BOUNDS_H_
\ No newline at end of file
@@ -0,0 +1,283 @@
+/**************************/
+/*  FILE NAME: crowd.cpp  */
+/**************************/
+#include "crowd.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+
+static_assert(sizeof(CrowdInstance) == 64, "CrowdInstance must match the instance attributes of GLSL/anim_crowd_vert.glsl");
+
+/* default constructor */
+CrowdInstance::CrowdInstance()
+    : transform()
+    , texel_offset(0)
+    , frame_count(1)
+    , time_offset(0.0f)
+    , clip_id(0)
+{ /* empty */ }
+
+/* copy constructor */
+CrowdInstance::CrowdInstance(const CrowdInstance& other)
+    : transform(other.transform)
+    , texel_offset(other.texel_offset)
+    , frame_count(other.frame_count)
+    , time_offset(other.time_offset)
+    , clip_id(other.clip_id)
+{ /* empty */ }
+
+
+/* default constructor */
+BakedClip::BakedClip()
+    : texel_offset(0)
+    , frame_count(0)
+{ /* empty */ }
+
+/* copy constructor */
+BakedClip::BakedClip(const BakedClip& other)
+    : texel_offset(other.texel_offset)
+    , frame_count(other.frame_count)
+{ /* empty */ }
+
+
+/* default constructor */
+Crowd::Crowd()
+    : palette()
+    , clips()
+    , mesh_offsets()
+    , frame_stride(0)
+    , frames_per_second(0.0f)
+    , time(0.0)
+    , instances()
+    , attached_vertex_arrays()
+    , capacity(0)
+    , dirty(false)
+    , instance_buffer(0)
+{ /* empty */ }
+
+/* copy constructor */
+Crowd::Crowd(const Crowd& other)
+    : palette(other.palette)
+    , clips(other.clips)
+    , mesh_offsets(other.mesh_offsets)
+    , frame_stride(other.frame_stride)
+    , frames_per_second(other.frames_per_second)
+    , time(other.time)
+    , instances(other.instances)
+    , attached_vertex_arrays(other.attached_vertex_arrays)
+    , capacity(other.capacity)
+    , dirty(other.dirty)
+    , instance_buffer(other.instance_buffer)
+{ /* empty */ }
+
+/* function to create the baked palette and the instance buffer */
+void Crowd::SetupCrowd()
+{
+    palette.SetupPalette();
+    glGenBuffers(1, &instance_buffer);
+    attached_vertex_arrays.clear();
+    capacity = 0;
+    dirty = true;
+}
+
+/* function to clean up the baked palette and the instance buffer */
+void Crowd::CleanupCrowd()
+{
+    palette.CleanupPalette();
+    GLState::Get().DeleteBuffer(instance_buffer);
+    instance_buffer = 0;
+    attached_vertex_arrays.clear();
+    capacity = 0;
+}
+
+/* function to advance the time shared by every instance */
+void Crowd::Update(double delta_time)
+{
+    time += delta_time;
+}
+
+/* function to drop the baked clips before the animations are sampled again */
+void Crowd::BeginBake(float frames_per_second)
+{
+    if(frames_per_second <= 0.0f)
+        throw std::runtime_error("crowd bake error: the frame rate must be positive.");
+
+    palette.Clear();
+    clips.clear();
+    mesh_offsets.clear();
+    frame_stride = 0;
+    this->frames_per_second = frames_per_second;
+}
+
+/* function to start the frames of the next animation */
+void Crowd::BeginClip()
+{
+    BakedClip clip;
+    clip.texel_offset = static_cast<int>(palette.Size());
+    clips.push_back(clip);
+}
+
+/* function to append the joint matrices of every skinned mesh as one frame */
+/* NOTE: the layout of the first frame is used by every frame               */
+void Crowd::AppendFrame(const std::map<int, Mesh>& meshes)
+{
+    if(clips.empty() == true)
+        throw std::runtime_error("crowd bake error: a frame was appended before BeginClip().");
+
+    const int frame_offset = static_cast<int>(palette.Size());
+    for(const auto& mesh : meshes)
+    {
+        if(mesh.second.joint_matrices.empty() == true)
+            continue;
+
+        const int offset = palette.Append(mesh.second.joint_matrices) - frame_offset;
+        if(frame_stride == 0)
+            mesh_offsets[mesh.first] = offset;
+        else if(mesh_offsets.count(mesh.first) == 0 || mesh_offsets[mesh.first] != offset)
+            throw std::runtime_error("crowd bake error: the joint layout changed between frames.");
+    }
+
+    const int stride = static_cast<int>(palette.Size()) - frame_offset;
+    if(frame_stride != 0 && stride != frame_stride)
+        throw std::runtime_error("crowd bake error: the joint layout changed between frames.");
+
+    frame_stride = stride;
+    clips.back().frame_count += 1;
+}
+
+/* function to add an instance playing a baked clip, returns its index */
+int Crowd::AddInstance(const orca::affine<float>& transform, int clip_id, float time_offset)
+{
+    if(clip_id < 0 || clip_id >= static_cast<int>(clips.size()))
+        throw std::runtime_error("crowd error: clip id out of range.");
+
+    CrowdInstance instance;
+    instance.transform = transform;
+    instance.texel_offset = clips[clip_id].texel_offset;
+    instance.frame_count = clips[clip_id].frame_count;
+    instance.time_offset = time_offset;
+    instance.clip_id = clip_id;
+    instances.push_back(instance);
+
+    dirty = true;
+    return static_cast<int>(instances.size() - 1);
+}
+
+/* function to remove every instance */
+void Crowd::ClearInstances()
+{
+    instances.clear();
+    dirty = true;
+}
+
+/* function to upload the baked palette and the instances if they changed */
+void Crowd::Upload()
+{
+    palette.Upload();
+    if(dirty == false || instances.empty() == true)
+        return;
+
+    const std::size_t bytes = sizeof(CrowdInstance) * instances.size();
+    GLState::Get().BindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+    if(instances.size() > capacity)
+    {
+        capacity = instances.size();
+        glBufferData(GL_ARRAY_BUFFER, bytes, instances.data(), GL_DYNAMIC_DRAW);
+    }
+    else glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, instances.data());
+    dirty = false;
+}
+
+/* function to bind the baked palette to the active texture unit */
+void Crowd::BindPalette()
+{
+    palette.BindPalette();
+}
+
+/* function to add the instance attributes (locations 5 to 9) to a vertex array */
+/* NOTE: done once per vertex array, the attributes keep reading the buffer     */
+void Crowd::AttachInstances(unsigned int vertex_array)
+{
+    if(std::find(attached_vertex_arrays.begin(), attached_vertex_arrays.end(), vertex_array) != attached_vertex_arrays.end())
+        return;
+
+    GLState& state = GLState::Get();
+    state.BindVertexArray(vertex_array);
+    state.BindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+
+    /* one row of the transform per attribute */
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+        glEnableVertexAttribArray(5 + i);
+        glVertexAttribPointer(5 + i, 4, GL_FLOAT, GL_FALSE, sizeof(CrowdInstance), reinterpret_cast<void*>(offsetof(CrowdInstance, transform) + sizeof(orca::vec4<float>) * i));
+        glVertexAttribDivisor(5 + i, 1);
+    }
+
+    glEnableVertexAttribArray(8);
+    glVertexAttribIPointer(8, 2, GL_INT, sizeof(CrowdInstance), reinterpret_cast<void*>(offsetof(CrowdInstance, texel_offset)));
+    glVertexAttribDivisor(8, 1);
+
+    glEnableVertexAttribArray(9);
+    glVertexAttribPointer(9, 1, GL_FLOAT, GL_FALSE, sizeof(CrowdInstance), reinterpret_cast<void*>(offsetof(CrowdInstance, time_offset)));
+    glVertexAttribDivisor(9, 1);
+
+    attached_vertex_arrays.push_back(vertex_array);
+}
+
+/* function to return the number of instances */
+std::size_t Crowd::Size() const
+{
+    return instances.size();
+}
+
+/* function to return the number of baked clips */
+std::size_t Crowd::NumClips() const
+{
+    return clips.size();
+}
+
+/* function to return the texel offset of a mesh inside a frame (-1 if it is not skinned) */
+int Crowd::GetMeshOffset(int mesh_id) const
+{
+    auto it = mesh_offsets.find(mesh_id);
+    return (it == mesh_offsets.end()) ? -1 : it->second;
+}
+
+/* function to return the number of texels of a baked frame */
+int Crowd::GetFrameStride() const
+{
+    return frame_stride;
+}
+
+/* function to return the rate the clips were sampled at */
+float Crowd::GetFramesPerSecond() const
+{
+    return frames_per_second;
+}
+
+/* function to return the time shared by every instance */
+float Crowd::GetTime() const
+{
+    return static_cast<float>(time);
+}
+
+/* function to return the size of the baked palette */
+std::size_t Crowd::PaletteBytes() const
+{
+    return sizeof(orca::vec4<float>) * palette.Size();
+}
+
+/* function to return the bytes of the baked palette and the instances */
+MemoryUsage Crowd::GetMemoryUsage() const
+{
+    MemoryUsage usage;
+    usage.AddCpu(MEMORY_CATEGORY::PALETTES, VectorBytes(palette.GetTexels()) + VectorBytes(instances));
+    usage.AddGpu(MEMORY_CATEGORY::PALETTES, palette.AllocatedBytes() + sizeof(CrowdInstance) * capacity);
+    return usage;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+/************************/
+/*  FILE NAME: crowd.h  */
+/************************/
+#ifndef _CROWD_H_
+#define _CROWD_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <map>
+#include <vector>
+#include <cstddef>
+#include <matrix.hpp>
+#include "mesh.h"
+#include "joint_palette.h"
+#include "memory_usage.h"
+
+/*******************************/
+/*  CLASS NAME: CrowdInstance  */
+/*******************************/
+/* per-instance vertex data of a crowd (64 bytes, advanced once per instance) */
+class CrowdInstance
+{
+public:
+    CrowdInstance();
+    CrowdInstance(const CrowdInstance& other);
+
+public:
+    orca::affine<float> transform;  /* model to world transform of the instance */
+    int texel_offset;               /* first palette texel of the baked clip     */
+    int frame_count;                /* number of frames of the baked clip        */
+    float time_offset;              /* seconds added to the crowd time           */
+    int clip_id;
+}; // class CrowdInstance
+
+/***************************/
+/*  CLASS NAME: BakedClip  */
+/***************************/
+class BakedClip
+{
+public:
+    BakedClip();
+    BakedClip(const BakedClip& other);
+
+public:
+    int texel_offset;
+    int frame_count;
+}; // class BakedClip
+
+/***********************/
+/*  CLASS NAME: Crowd  */
+/***********************/
+/* instances of one skinned model drawn with one instanced draw per mesh.      */
+/* every animation is baked into a palette of frames sampled at a fixed rate,  */
+/* each frame holding the joint matrices of all skinned meshes in the same     */
+/* layout, so the shader finds the joints of an instance from its clip range,  */
+/* the crowd time and its time offset. nothing is uploaded per frame unless    */
+/* the instances change.                                                       */
+class Crowd
+{
+public:
+    Crowd();
+    Crowd(const Crowd& other);
+
+public:
+    void SetupCrowd();
+    void CleanupCrowd();
+    void Update(double delta_time);
+
+public:
+    void BeginBake(float frames_per_second);
+    void BeginClip();
+    void AppendFrame(const std::map<int, Mesh>& meshes);
+
+public:
+    int AddInstance(const orca::affine<float>& transform, int clip_id, float time_offset);
+    void ClearInstances();
+    void Upload();
+    void BindPalette();
+    void AttachInstances(unsigned int vertex_array);
+
+public:
+    std::size_t Size() const;
+    std::size_t NumClips() const;
+    int GetMeshOffset(int mesh_id) const;
+    int GetFrameStride() const;
+    float GetFramesPerSecond() const;
+    float GetTime() const;
+    std::size_t PaletteBytes() const;
+    MemoryUsage GetMemoryUsage() const;
+
+private:
+    JointPalette palette;
+    std::vector<BakedClip> clips;
+    std::map<int, int> mesh_offsets;    /* texel offset of each skinned mesh in a frame */
+    int frame_stride;                   /* texels per frame */
+    float frames_per_second;
+    double time;
+
+    std::vector<CrowdInstance> instances;
+    std::vector<unsigned int> attached_vertex_arrays;
+    std::size_t capacity;
+    bool dirty;
+    unsigned int instance_buffer;
+}; // class Crowd
+#endif // !_CROWD_H_
\ No newline at end of file
@@ -0,0 +1,62 @@
+/********************************/
+/*  FILE NAME: frame_arena.cpp  */
+/********************************/
+#include "frame_arena.h"
+
+/* default constructor */
+FrameArena::FrameArena()
+    : block(std::make_unique<unsigned char[]>(DEFAULT_BLOCK_SIZE))
+    , block_size(DEFAULT_BLOCK_SIZE)
+    , offset(0)
+    , overflow_blocks()
+    , overflow_bytes(0)
+{ /* empty */ }
+
+/* function to release everything allocated since the last Reset()      */
+/* NOTE: if the frame overflowed, the block grows to what it used, so   */
+/*       the same frame fits in the block next time                     */
+void FrameArena::Reset()
+{
+    if(overflow_blocks.empty() == false)
+    {
+        block_size = offset + overflow_bytes;
+        block = std::make_unique<unsigned char[]>(block_size);
+        overflow_blocks.clear();
+    }
+    offset = 0;
+    overflow_bytes = 0;
+}
+
+/* function to return 'bytes' of memory aligned to 'alignment' (a power of 2, at most that of std::max_align_t) */
+void* FrameArena::Allocate(std::size_t bytes, std::size_t alignment)
+{
+    const std::size_t aligned_offset = (offset + alignment - 1) & ~(alignment - 1);
+    if(aligned_offset + bytes <= block_size)
+    {
+        offset = aligned_offset + bytes;
+        return block.get() + aligned_offset;
+    }
+
+    /* NOTE: an extra block is aligned for any type, it is kept until Reset() */
+    overflow_blocks.push_back(std::make_unique<unsigned char[]>(std::max<std::size_t>(bytes, 1)));
+    overflow_bytes += bytes + alignment;
+    return overflow_blocks.back().get();
+}
+
+/* function to return the bytes of the block */
+std::size_t FrameArena::Capacity() const
+{
+    return block_size;
+}
+
+/* function to return the bytes allocated since the last Reset() */
+std::size_t FrameArena::Used() const
+{
+    return offset + overflow_bytes;
+}
+
+/* function to return the number of blocks in use (more than 1 until the block has grown) */
+std::size_t FrameArena::NumBlocks() const
+{
+    return 1 + overflow_blocks.size();
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+/******************************/
+/*  FILE NAME: frame_arena.h  */
+/******************************/
+#ifndef _FRAME_ARENA_H_
+#define _FRAME_ARENA_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <new>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+/****************************/
+/*  CLASS NAME: FrameArena  */
+/****************************/
+/* linear allocator for the scratch memory of a frame: Allocate() bumps an    */
+/* offset and Reset() rewinds it, nothing is freed one by one. a frame that   */
+/* needs more than the block gets extra blocks, and the next Reset() replaces */
+/* them with one block as large as that frame needed, so once warmed up a    */
+/* frame makes no heap allocation. the memory is not valid after Reset().     */
+class FrameArena
+{
+public:
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 16U * 1024U;
+
+public:
+    FrameArena();
+    FrameArena(const FrameArena& other) = delete;
+
+public:
+    FrameArena& operator=(const FrameArena& rhs) = delete;
+
+public:
+    void Reset();
+    void* Allocate(std::size_t bytes, std::size_t alignment);
+    template<typename T>
+    T* AllocateArray(std::size_t count);
+
+public:
+    std::size_t Capacity() const;
+    std::size_t Used() const;
+    std::size_t NumBlocks() const;
+
+private:
+    std::unique_ptr<unsigned char[]> block;
+    std::size_t block_size;
+    std::size_t offset;
+    std::vector<std::unique_ptr<unsigned char[]>> overflow_blocks;
+    std::size_t overflow_bytes;     /* allocated from 'overflow_blocks' since the last Reset() */
+}; // class FrameArena
+
+/* function to return uninitialized storage for 'count' objects of T */
+/* NOTE: the objects are never destroyed, T should not own resources */
+template<typename T>
+T* FrameArena::AllocateArray(std::size_t count)
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "FrameArena does not over-align");
+    return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+}
+
+/* function to order 'items' by 'key(item)' (a std::uint64_t), items with the same */
+/* key keep their order. the keys are sorted in scratch memory of 'arena', so      */
+/* unlike std::stable_sort no temporary buffer is allocated on the heap.           */
+template<typename T, typename Key>
+void SortByKey(std::vector<T>& items, FrameArena& arena, Key key)
+{
+    struct SortEntry
+    {
+        std::uint64_t key;
+        std::size_t index;
+    };
+
+    const std::size_t count = items.size();
+    if(count < 2)
+        return;
+
+    SortEntry* entries = arena.AllocateArray<SortEntry>(count);
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        entries[i].key = key(items[i]);
+        entries[i].index = i;
+    }
+    std::sort(entries, entries + count, [](const SortEntry& a, const SortEntry& b)
+    {
+        return (a.key != b.key) ? (a.key < b.key) : (a.index < b.index);
+    });
+
+    /* the items are gathered in sorted order and copied back */
+    T* sorted = arena.AllocateArray<T>(count);
+    for(std::size_t i = 0; i < count; ++i)
+        new (&sorted[i]) T(items[entries[i].index]);
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        items[i] = sorted[i];
+        sorted[i].~T();
+    }
+}
+#endif // !_FRAME_ARENA_H_
\ No newline at end of file
@@ -0,0 +1,94 @@
+/************************************/
+/*  FILE NAME: geometry_buffer.cpp  */
+/************************************/
+#include "geometry_buffer.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+
+/* default constructor */
+GeometryBuffer::GeometryBuffer()
+    : num_vertices(0)
+    , multi_draw_indirect(false)
+    , vbo(0)
+    , vao(0)
+{ /* empty */ }
+
+/* copy constructor */
+GeometryBuffer::GeometryBuffer(const GeometryBuffer& other)
+    : num_vertices(other.num_vertices)
+    , multi_draw_indirect(other.multi_draw_indirect)
+    , vbo(other.vbo)
+    , vao(other.vao)
+{ /* empty */ }
+
+/* function to pack the vertices of every mesh into one buffer (sets 'first_vertex') */
+void GeometryBuffer::SetupBuffer(std::map<int, Mesh>& meshes)
+{
+    num_vertices = 0;
+    for(auto& mesh : meshes)
+    {
+        mesh.second.first_vertex = static_cast<unsigned int>(num_vertices);
+        num_vertices += mesh.second.vertices.size();
+    }
+
+    GLState& state = GLState::Get();
+    glGenBuffers(1, &vbo);
+    state.BindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * num_vertices, nullptr, GL_STATIC_DRAW);
+    for(const auto& mesh : meshes)
+    {
+        const auto& vertices = mesh.second.vertices;
+        glBufferSubData(GL_ARRAY_BUFFER, sizeof(Vertex) * mesh.second.first_vertex, sizeof(Vertex) * vertices.size(), vertices.data());
+    }
+
+    glGenVertexArrays(1, &vao);
+    state.BindVertexArray(vao);
+    SetupVertexAttributes(0);
+
+    /* NOTE: the base instance of a command is only read with GL 4.2 or ARB_base_instance */
+    multi_draw_indirect = GLEW_VERSION_4_3 || (GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance);
+    if(multi_draw_indirect == true)
+    {
+        glEnableVertexAttribArray(10);
+        glVertexAttribDivisor(10, 1);
+    }
+}
+
+/* function to clean up the shared vertex buffer */
+void GeometryBuffer::CleanupBuffer()
+{
+    GLState::Get().DeleteVertexArray(vao);
+    GLState::Get().DeleteBuffer(vbo);
+    vao = 0;
+    vbo = 0;
+    num_vertices = 0;
+}
+
+/* function to return the vertex buffer shared by the meshes */
+unsigned int GeometryBuffer::GetBuffer() const
+{
+    return vbo;
+}
+
+/* function to return the vertex array that reads every mesh */
+unsigned int GeometryBuffer::GetVertexArray() const
+{
+    return vao;
+}
+
+/* function to return the number of vertices in the buffer */
+std::size_t GeometryBuffer::NumVertices() const
+{
+    return num_vertices;
+}
+
+/* function to return true if glMultiDrawArraysIndirect can be used */
+bool GeometryBuffer::SupportsMultiDrawIndirect() const
+{
+    return multi_draw_indirect;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+/**********************************/
+/*  FILE NAME: geometry_buffer.h  */
+/**********************************/
+#ifndef _GEOMETRY_BUFFER_H_
+#define _GEOMETRY_BUFFER_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <map>
+#include <cstddef>
+#include "mesh.h"
+
+/********************************/
+/*  CLASS NAME: GeometryBuffer  */
+/********************************/
+/* the vertices of every mesh of a model in one vertex buffer. each mesh   */
+/* starts at its 'first_vertex', so one vertex array reads all of them and */
+/* a whole model can be drawn with one multi-draw call. location 10 of its  */
+/* vertex array is the per-draw DrawParameters (divisor 1, selected by the  */
+/* base instance of each indirect command).                                 */
+class GeometryBuffer
+{
+public:
+    GeometryBuffer();
+    GeometryBuffer(const GeometryBuffer& other);
+
+public:
+    void SetupBuffer(std::map<int, Mesh>& meshes);
+    void CleanupBuffer();
+
+public:
+    unsigned int GetBuffer() const;
+    unsigned int GetVertexArray() const;
+    std::size_t NumVertices() const;
+    bool SupportsMultiDrawIndirect() const;
+
+private:
+    std::size_t num_vertices;
+    bool multi_draw_indirect;
+    unsigned int vbo;
+    unsigned int vao;
+}; // class GeometryBuffer
+#endif // !_GEOMETRY_BUFFER_H_
\ No newline at end of file
@@ -0,0 +1,794 @@
+/********************************/
+/*  FILE NAME: gltf_loader.cpp  */
+/********************************/
+/* NOTE: tinygltf and stb_image are compiled here, the defines come before */
+/*       the header includes them                                          */
+#define TINYGLTF_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "gltf_loader.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <utility>
+#include <iostream>
+#include <stdexcept>
+#include <vector_functions.hpp>
+#include <matrix_functions.hpp>
+#include <affine_functions.hpp>
+#include <quaternion_functions.hpp>
+
+/* a function that checks if a file in glTF format is in binary format */
+/* returns ture if it is in binary format                              */
+bool IsBinaryFile(const std::string& file)
+{
+    bool binary = false;
+    std::size_t ext_pos = file.rfind('.', file.length());
+    if(ext_pos != std::string::npos)
+    {
+        binary = (file.substr(ext_pos + 1, file.length() - ext_pos) == "glb");
+    }
+    return binary;
+}
+
+/* function to load glTF model instance from glTF format file */
+void LoadglTFModel(tinygltf::Model& gltf_model, const std::string& file)
+{
+    std::string error;
+    std::string warning;
+    tinygltf::TinyGLTF gltf_loader;
+    bool is_loaded;
+
+    /* load from glTF file */
+    if(IsBinaryFile(file) == true)
+        is_loaded = gltf_loader.LoadBinaryFromFile(&gltf_model, &error, &warning, file);
+    else
+        is_loaded = gltf_loader.LoadASCIIFromFile(&gltf_model, &error, &warning, file);
+
+    /* check if it is loaded */
+    if(is_loaded == false)
+        throw std::runtime_error("Failed to load glTF file(" + file + "), error: " + error);
+
+    /* check for warning messages */
+    if(warning.empty() == false)
+        std::cout << "glTF warning: " << warning << std::endl;
+}
+
+/* a function that loads mesh data */
+/* return the loaded mesh          */
+Mesh LoadglTFMesh(const tinygltf::Model& gltf_model, const tinygltf::Mesh& gltf_mesh, FrameArena& scratch)
+{
+    Mesh mesh;
+    mesh.name = gltf_mesh.name;
+
+    /* NOTE: Assume that there is only one primitive in a mesh */
+    /* TODO: Modify it to work on more than one primitive. */
+    for(const auto& primitive : gltf_mesh.primitives)
+    {
+        /* save material id */
+        mesh.material_id = primitive.material;
+
+        /* load indices data                                                      */
+        /* NOTE: the indices of the accessor are decoded into 'scratch', only the */
+        /*       'TRIANGLES' mode indices are kept in the mesh                    */
+        std::size_t count = 0;
+        unsigned int* primitive_indices = nullptr;
+        {
+            const auto& accessor = gltf_model.accessors[primitive.indices];
+            const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
+            const auto& buffer = gltf_model.buffers[buffer_view.buffer];
+
+            const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
+            const auto byte_stride = accessor.ByteStride(buffer_view);
+            count = accessor.count;
+
+            primitive_indices = scratch.AllocateArray<unsigned int>(count);
+            if(accessor.type == TINYGLTF_TYPE_SCALAR)
+            {
+                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_BYTE
+                    || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE)
+                {
+                    for(std::size_t i = 0; i < count; ++i)
+                        primitive_indices[i] = *(reinterpret_cast<const char*>(data_address + i * byte_stride));
+                }
+                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_SHORT
+                        || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
+                {
+                    for(std::size_t i = 0; i < count; ++i)
+                        primitive_indices[i] = *(reinterpret_cast<const short*>(data_address + i * byte_stride));
+                }
+                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_INT
+                        || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT)
+                {
+                    for(std::size_t i = 0; i < count; ++i)
+                        primitive_indices[i] = *(reinterpret_cast<const int*>(data_address + i * byte_stride));
+                }
+                else { throw std::runtime_error("Undefined indices component type."); }
+            }
+            else { throw std::runtime_error("Undefined indices type."); }
+        }
+
+
+        /* converts an indices array into the 'TRIANGLES' mode indices array */
+        mesh.indices.clear();
+        if(primitive.mode == TINYGLTF_MODE_TRIANGLES)
+        {
+            mesh.indices.assign(primitive_indices, primitive_indices + count);
+        }
+        else if(primitive.mode == TINYGLTF_MODE_TRIANGLE_FAN)
+        {
+            mesh.indices.reserve((count > 2) ? (count - 2) * 3 : 0);
+            for(std::size_t i = 2; i < count; ++i)
+            {
+                mesh.indices.push_back(primitive_indices[0]);
+                mesh.indices.push_back(primitive_indices[i - 1]);
+                mesh.indices.push_back(primitive_indices[i - 0]);
+            }
+        }
+        else if(primitive.mode == TINYGLTF_MODE_TRIANGLE_STRIP)
+        {
+            mesh.indices.reserve((count > 2) ? (count - 2) * 3 : 0);
+            for(std::size_t i = 2; i < count; ++i)
+            {
+                mesh.indices.push_back(primitive_indices[i - 2]);
+                mesh.indices.push_back(primitive_indices[i - 1]);
+                mesh.indices.push_back(primitive_indices[i - 0]);
+            }
+        }
+        else if(count > 0) { throw std::runtime_error("Undefined primitive mode."); }
+
+
+        mesh.vertices.resize(mesh.indices.size());
+        for(const auto& attribute : primitive.attributes)
+        {
+            /* load vertices data */
+            /* NOTE: render witout using an index buffer      */
+            /* TODO: change to use index buffer for rendering */
+            {
+                const auto& accessor = gltf_model.accessors[attribute.second];
+                const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
+                const auto& buffer = gltf_model.buffers[buffer_view.buffer];
+
+                const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
+                const auto byte_stride = accessor.ByteStride(buffer_view);
+
+                if(attribute.first == "POSITION")
+                {
+                    /* NOTE: the bounds of the accessor are used if the file has them */
+                    if(accessor.minValues.size() == 3 && accessor.maxValues.size() == 3)
+                    {
+                        mesh.local_bounds = BoundingBox();
+                        mesh.local_bounds.Extend(orca::MakeVector3<float, double>(accessor.minValues.data()));
+                        mesh.local_bounds.Extend(orca::MakeVector3<float, double>(accessor.maxValues.data()));
+                    }
+
+                    if(accessor.type == TINYGLTF_TYPE_VEC3)
+                    {
+                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].position.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].position.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].position.z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + face * byte_stride));
+                            }
+                        }
+                        else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].position.x = *(reinterpret_cast<const double*>(data_address + 0 *sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].position.y = *(reinterpret_cast<const double*>(data_address + 1 *sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].position.z = *(reinterpret_cast<const double*>(data_address + 2 *sizeof(double) + face * byte_stride));
+                            }
+                        }
+                        else { throw std::runtime_error("Undefined \'POSITION\' attribute component type."); }
+                    }  
+                    else { throw std::runtime_error("Undefined \'POSITION\' attribute type."); }
+                } // endif 'POSITION'
+                else if(attribute.first == "NORMAL")
+                {
+                    if(accessor.type == TINYGLTF_TYPE_VEC3)
+                    {
+                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].normal.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].normal.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].normal.z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + face * byte_stride));
+                            }
+                        }
+                        else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].normal.x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].normal.y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].normal.z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + face * byte_stride));
+                            }
+                        }
+                        else { throw std::runtime_error("Undefined \'NORMAL\' attribute component type."); }
+                    }
+                    else { throw std::runtime_error("Undefined \'NORMAL\' attribute type."); }
+                } // endif 'NORMAL'
+                else if(attribute.first == "TEXCOORD_0")
+                {
+                    if(accessor.type == TINYGLTF_TYPE_VEC2)
+                    {
+                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].texcoord.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].texcoord.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
+                            }
+                        }
+                        else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].texcoord.x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].texcoord.y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + face * byte_stride));
+                            }
+                        }
+                        else { throw std::runtime_error("Undefined \'TEXCOORD_0\' attribute component type."); }
+                    }
+                    else { throw std::runtime_error("Undefined \'TEXCOORD_0\' attribute type."); }
+                } // endif 'TEXCOORD_0'
+                else if(attribute.first == "JOINTS_0")
+                {
+                    if(accessor.type == TINYGLTF_TYPE_VEC4)
+                    {
+                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_SHORT
+                            || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
+                        {   
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].joint.x = *(reinterpret_cast<const short*>(data_address + 0 * sizeof(short) + face * byte_stride));
+                                mesh.vertices[i].joint.y = *(reinterpret_cast<const short*>(data_address + 1 * sizeof(short) + face * byte_stride));
+                                mesh.vertices[i].joint.z = *(reinterpret_cast<const short*>(data_address + 2 * sizeof(short) + face * byte_stride));
+                                mesh.vertices[i].joint.w = *(reinterpret_cast<const short*>(data_address + 3 * sizeof(short) + face * byte_stride));
+                            }
+                        }
+                        else { throw std::runtime_error("Undefined \'JOINTS_0\' attribute component type."); }
+                    }
+                    else { throw std::runtime_error("Undefined \'JOINTS_0\' attribute type."); }
+                } // endif 'JOINTS_0'
+                else if(attribute.first == "WEIGHTS_0")
+                {
+                    if(accessor.type == TINYGLTF_TYPE_VEC4)
+                    {
+                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].weight.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].weight.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].weight.z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + face * byte_stride));
+                                mesh.vertices[i].weight.w = *(reinterpret_cast<const float*>(data_address + 3 * sizeof(float) + face * byte_stride));
+                            }
+                        }
+                        else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                        {
+                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
+                            {
+                                auto face = mesh.indices[i];
+                                mesh.vertices[i].weight.x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].weight.y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].weight.z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + face * byte_stride));
+                                mesh.vertices[i].weight.w = *(reinterpret_cast<const double*>(data_address + 3 * sizeof(double) + face * byte_stride));
+                            }
+                        }
+                        else { throw std::runtime_error("Undefined \'WEIGHTS_0\' attribute type."); }
+                    }
+                    else { throw std::runtime_error("Undefined \'WEIGHTS_0\' attribute type."); }
+                } // endif 'WEIGHTS_0'
+            }
+        } // for each attribute in primitive
+    } // for each primitive in glTF mesh
+
+    mesh.SetupBounds();
+    return mesh;
+}
+
+/* recursively load node data */
+void LoadglTFNode(const tinygltf::Model& gltf_model, const tinygltf::Node& gltf_node, int parent_id, int current_id, std::map<int, Node>& nodes)
+{
+    Node node;
+    node.name = gltf_node.name;
+    node.child_ids = gltf_node.children;
+    node.node_id = current_id;
+    node.parent_id = parent_id;
+    node.mesh_id = gltf_node.mesh;
+    node.skin_id = gltf_node.skin;
+
+    /* save matrix data */
+    if(gltf_node.matrix.size() == 16)
+    {
+        node.matrix = orca::MakeAffine(orca::MakeMatrix4X4<float, double>(gltf_node.matrix.data()));
+    }
+
+    /* save translation data */
+    if(gltf_node.translation.size() == 3)
+    {
+        node.translate = orca::MakeVector3<float>(gltf_node.translation.data());
+    }
+
+    /* save rotation data */
+    if(gltf_node.rotation.size() == 4)
+    {
+        /* store quaternion information in vec4 type */
+        node.rotate = orca::MakeVector4<float>(gltf_node.rotation.data());
+    }
+
+    /* save sacle data */
+    if(gltf_node.scale.size() == 3)
+    {
+        node.scale = orca::MakeVector3<float>(gltf_node.scale.data());
+    }
+
+    /* save the loaded node to the node map */
+    nodes.emplace(current_id, std::move(node));
+
+    /* stores child nodes */
+    for(std::size_t i = 0; i < gltf_node.children.size(); ++i)
+    {
+        LoadglTFNode(gltf_model, gltf_model.nodes[gltf_node.children[i]], current_id, gltf_node.children[i], nodes);
+    }
+}
+
+/* a function that loads skin data */
+/* return the loaded skin          */
+Skin LoadglTFSkin(const tinygltf::Model& gltf_model, const tinygltf::Skin& gltf_skin)
+{
+    Skin skin;
+    skin.name = gltf_skin.name;
+    skin.joints = gltf_skin.joints;
+    skin.skeleton_root_id = gltf_skin.skeleton;
+
+    /* store inverse bind matrices */
+    if(gltf_skin.inverseBindMatrices > -1)
+    {
+        const auto& accessor = gltf_model.accessors[gltf_skin.inverseBindMatrices];
+        const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
+        const auto& buffer = gltf_model.buffers[buffer_view.buffer];
+
+        const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
+        const auto byte_stride = accessor.ByteStride(buffer_view);
+        const auto count = accessor.count;
+
+        if(accessor.type == TINYGLTF_TYPE_MAT4)
+        {
+            if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+            {
+                skin.inverse_bind_matrices.reserve(count);
+                for(std::size_t i = 0; i < count; ++i)
+                {
+                    orca::affine<float> mat = orca::MakeAffine(orca::MakeMatrix4X4<float, float>(reinterpret_cast<const float*>(data_address + i * byte_stride)));
+                    skin.inverse_bind_matrices.emplace_back(mat);
+                }
+            }
+            else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+            {
+                skin.inverse_bind_matrices.reserve(count);
+                for(std::size_t i = 0; i < count; ++i)
+                {
+                    orca::affine<float> mat = orca::MakeAffine(orca::MakeMatrix4X4<float, double>(reinterpret_cast<const double*>(data_address + i * byte_stride)));
+                    skin.inverse_bind_matrices.emplace_back(mat);
+                }
+            }
+            else { throw std::runtime_error("Undefined inverse bind matrices component type."); }
+        }
+        else { throw std::runtime_error("Undefined inverse bind matrices type."); }
+    }
+
+    return skin;
+}
+
+/* a function that loads animation data */
+/* return the loaded animation          */
+Animation LoadglTFAnimation(const tinygltf::Model& gltf_model, const tinygltf::Animation& gltf_animation)
+{
+    Animation animation;
+    animation.name = gltf_animation.name;
+
+    /* save animation sampler information */
+    animation.samplers.reserve(gltf_animation.samplers.size());
+    for(const auto& sampler : gltf_animation.samplers)
+    {
+        AnimationSampler anim_sampler;
+
+        /* save the animation sampler interpolation information */
+        if(sampler.interpolation == "LINEAR")
+        {
+            anim_sampler.interpolation = INTERPOLATION_TYPE::LINEAR;
+        }
+        else if(sampler.interpolation == "STEP")
+        {
+            anim_sampler.interpolation = INTERPOLATION_TYPE::STEP;
+        }
+        else if(sampler.interpolation == "CUBICSPLINE")
+        {
+            anim_sampler.interpolation = INTERPOLATION_TYPE::CUBICSPLINE;
+        }
+        else 
+        { 
+            anim_sampler.interpolation = INTERPOLATION_TYPE::UNKNOWN;
+            std::cout << "Undefined animation sampler interpolation. "; 
+            std::cout << "(interpolation: " << sampler.interpolation << ")" << std::endl;
+        }
+
+        /* save animation sampler input information */
+        {
+            const auto& accessor = gltf_model.accessors[sampler.input];
+            const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
+            const auto& buffer = gltf_model.buffers[buffer_view.buffer];
+
+            const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
+            const auto byte_stride = accessor.ByteStride(buffer_view);
+            const auto count = accessor.count;
+
+            if(accessor.type == TINYGLTF_TYPE_SCALAR)
+            {
+                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                {
+                    anim_sampler.inputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        anim_sampler.inputs.emplace_back(*(reinterpret_cast<const float*>(data_address + i * byte_stride)));
+                    }
+                }
+                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                {
+                    anim_sampler.inputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        anim_sampler.inputs.emplace_back(*(reinterpret_cast<const double*>(data_address + i * byte_stride)));
+                    }
+                }
+                else { throw std::runtime_error("Warning::Undefined animation sampler inputs component type."); }
+            }
+            else { throw std::runtime_error("Undefined animation sampler inputs type."); }
+        }
+
+        /* save start time and end time of animation */
+        for(const auto& input : anim_sampler.inputs)
+        {
+            if(input < animation.start_time)
+            {
+                animation.start_time = input;
+            }
+
+            if(input > animation.end_time)
+            {
+                animation.end_time = input;
+            }
+        }
+
+        /* save the animation sampler outputs information */
+        {
+            const auto& accessor = gltf_model.accessors[sampler.output];
+            const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
+            const auto& buffer = gltf_model.buffers[buffer_view.buffer];
+
+            const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
+            const auto byte_stride = accessor.ByteStride(buffer_view);
+            const auto count = accessor.count;
+
+            /* FIXME: the animation sampler output type of some modeling files is not processed */
+            if(accessor.type == TINYGLTF_TYPE_VEC3)
+            {
+                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                {
+                    anim_sampler.outputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        float x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + i * byte_stride));
+                        float y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + i * byte_stride));
+                        float z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + i * byte_stride));
+                        float w = 0.0f;
+                        anim_sampler.outputs.emplace_back(x, y, z, w);
+                    }
+                }
+                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                {
+                    anim_sampler.outputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        double x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + i * byte_stride));
+                        double y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + i * byte_stride));
+                        double z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + i * byte_stride));
+                        double w = 0.0f;
+                        anim_sampler.outputs.emplace_back(x, y, z, w);
+                    }
+                }
+                else { throw std::runtime_error("Undefined animation sampler outputs component type."); }
+            }
+            else if(accessor.type == TINYGLTF_TYPE_VEC4)
+            {
+                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                {
+                    anim_sampler.outputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        float x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + i * byte_stride));
+                        float y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + i * byte_stride));
+                        float z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + i * byte_stride));
+                        float w = *(reinterpret_cast<const float*>(data_address + 3 * sizeof(float) + i * byte_stride));
+                        anim_sampler.outputs.emplace_back(x, y, z, w);
+                    }
+                }
+                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                {
+                    anim_sampler.outputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        double x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + i * byte_stride));
+                        double y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + i * byte_stride));
+                        double z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + i * byte_stride));
+                        double w = *(reinterpret_cast<const double*>(data_address + 3 * sizeof(double) + i * byte_stride));
+                        anim_sampler.outputs.emplace_back(x, y, z, w);
+                    }
+                }
+                else { throw std::runtime_error("Undefined animation sampler outputs component type."); }
+            }
+            else if(accessor.type == TINYGLTF_TYPE_SCALAR)
+            {
+                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+                {
+                    anim_sampler.outputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        double x = *(reinterpret_cast<const float*>(data_address + i * byte_stride));
+                        anim_sampler.outputs.emplace_back(x, 0, 0, 0);
+                    }
+                }
+                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
+                {
+                    anim_sampler.outputs.reserve(count);
+                    for(std::size_t i = 0; i < count; ++i)
+                    {
+                        double x = *(reinterpret_cast<const double*>(data_address + i * byte_stride));
+                        anim_sampler.outputs.emplace_back(x, 0, 0, 0);
+                    }
+                }
+                else { throw std::runtime_error("Undefined animation sampler outputs component type."); }
+            }
+            else { throw std::runtime_error("Undefined animation sampler outputs type."); }
+        }
+
+        animation.samplers.emplace_back(std::move(anim_sampler));
+    } // for each sampler in glTF animation
+
+
+    /* save animation channel information */
+    animation.channels.reserve(gltf_animation.channels.size());
+    for(auto& channel : gltf_animation.channels)
+    {
+        AnimationChannel anim_channel;
+
+        /* save animation channel path type information */
+        if(channel.target_path == "rotation")
+        {
+            anim_channel.path_type = PATH_TYPE::ROTATION;
+        }
+        else if(channel.target_path == "translation")
+        {
+            anim_channel.path_type = PATH_TYPE::TRANSLATION;
+        }
+        else if(channel.target_path == "scale")
+        {
+            anim_channel.path_type = PATH_TYPE::SCALE;
+        }
+        else if(channel.target_path == "weights")
+        {
+            anim_channel.path_type = PATH_TYPE::WEIGHTS;
+        }
+        else 
+        {
+            anim_channel.path_type = PATH_TYPE::UNKNOWN;
+            std::cout << "Warning::Undefined animation channel path type. ";
+            std::cout << "(path type: " << channel.target_path << ")" << std::endl;
+        }
+
+        anim_channel.node_id = channel.target_node;
+        anim_channel.sampler_id = channel.sampler;
+
+        animation.channels.emplace_back(anim_channel);
+    } // for each channel in glTF animation
+
+    return animation;
+}
+
+/* a function that loads texture data */
+/* return the loaded texture          */
+Texture LoadglTFTexture(const tinygltf::Model& gltf_model, const tinygltf::Texture& gltf_texture)
+{
+    Texture texture;
+    
+    /* save the glTF image */
+    {
+        const tinygltf::Image& gltf_image = gltf_model.images[gltf_texture.source];
+        texture.image.name = gltf_image.uri;
+        texture.image.width = gltf_image.width;
+        texture.image.height = gltf_image.height;
+        texture.image.component = gltf_image.component;
+        texture.image.data = gltf_image.image;
+    }
+
+    /* save the glTF image sampler */
+    {
+        if(gltf_texture.sampler > -1)
+        {
+            const tinygltf::Sampler& gltf_sampler = gltf_model.samplers[gltf_texture.sampler];
+            texture.sampler.name = gltf_sampler.name;
+            texture.sampler.min_filter = GetFilterMode(gltf_sampler.minFilter);
+            texture.sampler.mag_filter = GetFilterMode(gltf_sampler.magFilter);
+            texture.sampler.wrap_R = GetWrapMode(gltf_sampler.wrapR);
+            texture.sampler.wrap_S = GetWrapMode(gltf_sampler.wrapS);
+            texture.sampler.wrap_T = GetWrapMode(gltf_sampler.wrapT);
+        }
+    }
+
+    return texture;
+}
+
+/* a function that loads material data */
+/* return the loaded material          */
+Material LoadglTFMaterial(const tinygltf::Model& gltf_model, const tinygltf::Material& gltf_material)
+{
+    Material material;
+
+    {
+        auto base_color_texture_id = gltf_material.values.find("baseColorTexture");
+        if(base_color_texture_id != gltf_material.values.end())
+        {
+            material.base_color_texture_id = base_color_texture_id->second.TextureIndex();
+            material.texture_coordinate_sets.base_color = static_cast<unsigned char>(base_color_texture_id->second.TextureTexCoord());
+        }
+    }
+
+    {
+        auto metallic_roughness_texture = gltf_material.values.find("metallicRoughnessTexture");
+        if(metallic_roughness_texture != gltf_material.values.end())
+        {
+            material.metallic_roughness_texture_id = metallic_roughness_texture->second.TextureIndex();
+            material.texture_coordinate_sets.metallic_roughness = static_cast<unsigned char>(metallic_roughness_texture->second.TextureTexCoord());
+        }
+    }
+
+    {
+        auto roughness_factor = gltf_material.values.find("roughnessFactor");
+        if(roughness_factor != gltf_material.values.end())
+        {
+            material.roughness_factor = static_cast<float>(roughness_factor->second.Factor());
+        }
+    }
+
+    {
+        auto metallic_factor = gltf_material.values.find("metallicFactor");
+        if(metallic_factor != gltf_material.values.end())
+        {
+            material.metallic_factor = static_cast<float>(metallic_factor->second.Factor());
+        }
+    }
+
+    {
+        auto base_color_factor = gltf_material.values.find("baseColorFactor");
+        if(base_color_factor != gltf_material.values.end())
+        {
+            material.base_color_factor = orca::MakeVector4<float>(base_color_factor->second.ColorFactor().data());
+        }
+    }
+
+    {
+        auto normal_texture = gltf_material.additionalValues.find("normalTexture");
+        if(normal_texture != gltf_material.additionalValues.end())
+        {
+            material.normal_texture_id = normal_texture->second.TextureIndex();
+            material.texture_coordinate_sets.normal = static_cast<unsigned char>(normal_texture->second.TextureTexCoord());
+        }
+    }
+
+    {
+        auto emissive_texture = gltf_material.additionalValues.find("emissiveTexture");
+        if(emissive_texture != gltf_material.additionalValues.end())
+        {
+            material.emissive_texture_id = emissive_texture->second.TextureIndex();
+            material.texture_coordinate_sets.emissive = static_cast<unsigned char>(emissive_texture->second.TextureTexCoord());
+        }
+    }
+
+    {
+        auto occlusion_texture = gltf_material.additionalValues.find("occlusionTexture");
+        if(occlusion_texture != gltf_material.additionalValues.end())
+        {
+            material.occlusion_texture_id = occlusion_texture->second.TextureIndex();
+            material.texture_coordinate_sets.occlusion = static_cast<unsigned char>(occlusion_texture->second.TextureTexCoord());
+        }
+    }
+
+    {
+        auto alpha_mode = gltf_material.additionalValues.find("alphaMode");
+        if(alpha_mode != gltf_material.additionalValues.end())
+        {
+            const tinygltf::Parameter& param = alpha_mode->second;
+            if(param.string_value == "BLEND")
+            {
+                material.alpha_mode = ALPHA_MODE::ALPHA_MODE_BLEND;
+            }
+            else if(param.string_value == "MASK")
+            {
+                material.alpha_mode = ALPHA_MODE::ALPHA_MODE_MASK;
+                material.alpha_cutoff = 0.5f;
+            }
+        }
+    }
+
+    {
+        auto alpha_cutoff = gltf_material.additionalValues.find("alphaCutoff");
+        if(alpha_cutoff != gltf_material.additionalValues.end())
+        {
+            material.alpha_cutoff = static_cast<float>(alpha_cutoff->second.Factor());
+        }
+    }
+
+    {
+        auto emissive_factor = gltf_material.additionalValues.find("emissiveFactor");
+        if(emissive_factor != gltf_material.additionalValues.end())
+        {
+            material.emissive_factor = orca::vec4<float>(orca::MakeVector3<float>(emissive_factor->second.ColorFactor().data()), 1.0f);
+        }
+    }
+
+    // extensions
+    {
+        auto extension = gltf_material.extensions.find("KHR_materials_pbrSpecularGlossiness");
+        if(extension != gltf_material.extensions.end())
+        {
+            if(extension->second.Has("specularGlossinessTexture"))
+            {
+                material.extension.specular_glossiness_texture_id = extension->second.Get("specularGlossinessTexture").Get("index").Get<int>();
+                material.texture_coordinate_sets.specular_glossiness = static_cast<unsigned char>(extension->second.Get("specularGlossinessTexture").Get("texCoord").Get<int>());
+                material.work_flow = PBR_WORK_FLOW::SPECULAR_GLOSSINESS;
+            }
+
+            if(extension->second.Has("diffuseTexture"))
+            {
+                material.extension.diffuse_texture_id = extension->second.Get("diffuseTexture").Get("index").Get<int>();
+            }
+
+            if(extension->second.Has("diffuseFactor"))
+            {
+                auto factor = extension->second.Get("diffuseFactor");
+                for(std::size_t i = 0; i < factor.ArrayLen(); ++i)
+                {
+                    auto value = factor.Get(i);
+                    material.extension.diffuse_factor[i] = value.IsNumber() ? static_cast<float>(value.Get<double>()) : static_cast<float>(value.Get<int>());
+                }
+            }
+
+            if(extension->second.Has("specularFactor"))
+            {
+                auto factor = extension->second.Get("specularFactor");
+                for(std::size_t i = 0; i < factor.ArrayLen(); ++i)
+                {
+                    auto value = factor.Get(i);
+                    material.extension.specular_factor[i] = value.IsNumber() ? static_cast<float>(value.Get<double>()) : static_cast<float>(value.Get<int>());
+                }
+            }
+        }
+    }
+
+    return material;
+}
\ No newline at end of file
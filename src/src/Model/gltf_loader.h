@@ -0,0 +1,32 @@
+/******************************/
+/*  FILE NAME: gltf_loader.h  */
+/******************************/
+#ifndef _GLTF_LOADER_H_
+#define _GLTF_LOADER_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <map>
+#include <string>
+#include <tiny_gltf.h>
+#include "mesh.h"
+#include "node.h"
+#include "skin.h"
+#include "animation.h"
+#include "texture.h"
+#include "material.h"
+#include "frame_arena.h"
+
+/* functions that turn the parts of a tinygltf model into the classes of the */
+/* model. they only decode the accessors and images, nothing calls OpenGL.   */
+/* the temporaries of a mesh are taken from 'scratch', reset it between them */
+bool IsBinaryFile(const std::string& file);
+void LoadglTFModel(tinygltf::Model& gltf_model, const std::string& file);
+Mesh LoadglTFMesh(const tinygltf::Model& gltf_model, const tinygltf::Mesh& gltf_mesh, FrameArena& scratch);
+void LoadglTFNode(const tinygltf::Model& gltf_model, const tinygltf::Node& gltf_node, int parent_id, int current_id, std::map<int, Node>& nodes);
+Skin LoadglTFSkin(const tinygltf::Model& gltf_model, const tinygltf::Skin& gltf_skin);
+Animation LoadglTFAnimation(const tinygltf::Model& gltf_model, const tinygltf::Animation& gltf_animation);
+Texture LoadglTFTexture(const tinygltf::Model& gltf_model, const tinygltf::Texture& gltf_texture);
+Material LoadglTFMaterial(const tinygltf::Model& gltf_model, const tinygltf::Material& gltf_material);
+#endif // !_GLTF_LOADER_H_
\ No newline at end of file
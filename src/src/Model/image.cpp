@@ -3,6 +3,11 @@
 /**************************/
 #include "image.h"
 
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <utility>
+
 /* default constructor */
 Image::Image()
     : width()
@@ -19,4 +24,13 @@ Image::Image(const Image& other)
     , component(other.component)
     , data(other.data)
     , name(other.name)
+{ /* empty */ }
+
+/* move constructor */
+Image::Image(Image&& other) noexcept
+    : width(other.width)
+    , height(other.height)
+    , component(other.component)
+    , data(std::move(other.data))
+    , name(std::move(other.name))
 { /* empty */ }
\ No newline at end of file
@@ -18,6 +18,11 @@ class Image
 public:
     Image();
     Image(const Image& other);
+    Image(Image&& other) noexcept;
+
+public:
+    Image& operator=(const Image& rhs) = default;
+    Image& operator=(Image&& rhs) noexcept = default;
 
 public:
     int width;
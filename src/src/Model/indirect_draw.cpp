@@ -0,0 +1,145 @@
+/**********************************/
+/*  FILE NAME: indirect_draw.cpp  */
+/**********************************/
+#include "indirect_draw.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <algorithm>
+
+static_assert(sizeof(DrawArraysIndirectCommand) == 16, "DrawArraysIndirectCommand must match the OpenGL command layout");
+
+/* default constructor */
+DrawArraysIndirectCommand::DrawArraysIndirectCommand()
+    : count(0)
+    , instance_count(1)
+    , first(0)
+    , base_instance(0)
+{ /* empty */ }
+
+/* copy constructor */
+DrawArraysIndirectCommand::DrawArraysIndirectCommand(const DrawArraysIndirectCommand& other)
+    : count(other.count)
+    , instance_count(other.instance_count)
+    , first(other.first)
+    , base_instance(other.base_instance)
+{ /* empty */ }
+
+
+/* default constructor */
+DrawParameters::DrawParameters()
+    : joint_offset(0)
+    , material_id(-1)
+{ /* empty */ }
+
+/* copy constructor */
+DrawParameters::DrawParameters(const DrawParameters& other)
+    : joint_offset(other.joint_offset)
+    , material_id(other.material_id)
+{ /* empty */ }
+
+
+/* default constructor */
+IndirectBatch::IndirectBatch()
+    : texture(0)
+    , first_command(0)
+    , command_count(0)
+{ /* empty */ }
+
+/* copy constructor */
+IndirectBatch::IndirectBatch(const IndirectBatch& other)
+    : texture(other.texture)
+    , first_command(other.first_command)
+    , command_count(other.command_count)
+{ /* empty */ }
+
+
+/* default constructor */
+IndirectDrawList::IndirectDrawList()
+    : draws()
+    , commands()
+    , parameters()
+    , batches()
+{ /* empty */ }
+
+/* copy constructor */
+IndirectDrawList::IndirectDrawList(const IndirectDrawList& other)
+    : draws(other.draws)
+    , commands(other.commands)
+    , parameters(other.parameters)
+    , batches(other.batches)
+{ /* empty */ }
+
+/* function to remove the draws of the previous frame */
+void IndirectDrawList::Clear()
+{
+    draws.clear();
+    commands.clear();
+    parameters.clear();
+    batches.clear();
+}
+
+/* function to add a draw of 'vertex_count' vertices from 'first_vertex' */
+void IndirectDrawList::Push(unsigned int texture, unsigned int first_vertex, unsigned int vertex_count, int joint_offset, int material_id)
+{
+    Draw draw;
+    draw.sort_key = (static_cast<std::uint64_t>(texture) << 32) | static_cast<std::uint32_t>(material_id + 1);
+    draw.texture = texture;
+    draw.first_vertex = first_vertex;
+    draw.vertex_count = vertex_count;
+    draw.joint_offset = joint_offset;
+    draw.material_id = material_id;
+    draws.push_back(draw);
+}
+
+/* function to sort the draws by texture and fill the command, parameter and batch arrays */
+/* (the sort takes its scratch memory from 'arena')                                       */
+void IndirectDrawList::Build(FrameArena& arena)
+{
+    SortByKey(draws, arena, [](const Draw& draw) { return draw.sort_key; });
+
+    commands.resize(draws.size());
+    parameters.resize(draws.size());
+    batches.clear();
+    for(std::size_t i = 0; i < draws.size(); ++i)
+    {
+        const Draw& draw = draws[i];
+        commands[i].count = draw.vertex_count;
+        commands[i].instance_count = 1;
+        commands[i].first = draw.first_vertex;
+        commands[i].base_instance = static_cast<unsigned int>(i);
+        parameters[i].joint_offset = draw.joint_offset;
+        parameters[i].material_id = draw.material_id;
+
+        if(batches.empty() == true || batches.back().texture != draw.texture)
+        {
+            IndirectBatch batch;
+            batch.texture = draw.texture;
+            batch.first_command = static_cast<unsigned int>(i);
+            batches.push_back(batch);
+        }
+        batches.back().command_count += 1;
+    }
+}
+
+/* function to return the number of draws */
+std::size_t IndirectDrawList::Size() const
+{
+    return draws.size();
+}
+
+const std::vector<DrawArraysIndirectCommand>& IndirectDrawList::GetCommands() const
+{
+    return commands;
+}
+
+const std::vector<DrawParameters>& IndirectDrawList::GetParameters() const
+{
+    return parameters;
+}
+
+const std::vector<IndirectBatch>& IndirectDrawList::GetBatches() const
+{
+    return batches;
+}
\ No newline at end of file
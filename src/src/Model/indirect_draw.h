@@ -0,0 +1,107 @@
+/********************************/
+/*  FILE NAME: indirect_draw.h  */
+/********************************/
+#ifndef _INDIRECT_DRAW_H_
+#define _INDIRECT_DRAW_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "frame_arena.h"
+
+/*******************************************/
+/*  CLASS NAME: DrawArraysIndirectCommand  */
+/*******************************************/
+/* same layout as the command read by glMultiDrawArraysIndirect */
+class DrawArraysIndirectCommand
+{
+public:
+    DrawArraysIndirectCommand();
+    DrawArraysIndirectCommand(const DrawArraysIndirectCommand& other);
+
+public:
+    unsigned int count;
+    unsigned int instance_count;
+    unsigned int first;
+    unsigned int base_instance;     /* index of the draw, selects its DrawParameters */
+}; // class DrawArraysIndirectCommand
+
+/********************************/
+/*  CLASS NAME: DrawParameters  */
+/********************************/
+/* per-draw data read as an instanced attribute (GLSL/anim_mdi_vert.glsl) */
+class DrawParameters
+{
+public:
+    DrawParameters();
+    DrawParameters(const DrawParameters& other);
+
+public:
+    int joint_offset;
+    int material_id;
+}; // class DrawParameters
+
+/*******************************/
+/*  CLASS NAME: IndirectBatch  */
+/*******************************/
+/* commands that share a texture, submitted with one multi-draw call */
+class IndirectBatch
+{
+public:
+    IndirectBatch();
+    IndirectBatch(const IndirectBatch& other);
+
+public:
+    unsigned int texture;
+    unsigned int first_command;
+    unsigned int command_count;
+}; // class IndirectBatch
+
+/**********************************/
+/*  CLASS NAME: IndirectDrawList  */
+/**********************************/
+/* draws of a frame turned into indirect commands, per-draw parameters and */
+/* one batch per texture. it only builds the arrays on the CPU, uploading  */
+/* and submitting them is up to the caller (Model::RenderIndirect()).      */
+/* NOTE: the arrays keep their capacity and the sort uses scratch memory  */
+/*       of a FrameArena, so a frame does not allocate once the draw count */
+/*       has been reached.                                                 */
+class IndirectDrawList
+{
+public:
+    IndirectDrawList();
+    IndirectDrawList(const IndirectDrawList& other);
+
+public:
+    void Clear();
+    void Push(unsigned int texture, unsigned int first_vertex, unsigned int vertex_count, int joint_offset, int material_id);
+    void Build(FrameArena& arena);
+
+public:
+    std::size_t Size() const;
+    const std::vector<DrawArraysIndirectCommand>& GetCommands() const;
+    const std::vector<DrawParameters>& GetParameters() const;
+    const std::vector<IndirectBatch>& GetBatches() const;
+
+private:
+    class Draw
+    {
+    public:
+        std::uint64_t sort_key;
+        unsigned int texture;
+        unsigned int first_vertex;
+        unsigned int vertex_count;
+        int joint_offset;
+        int material_id;
+    }; // class Draw
+
+private:
+    std::vector<Draw> draws;
+    std::vector<DrawArraysIndirectCommand> commands;
+    std::vector<DrawParameters> parameters;
+    std::vector<IndirectBatch> batches;
+}; // class IndirectDrawList
+#endif // !_INDIRECT_DRAW_H_
\ No newline at end of file
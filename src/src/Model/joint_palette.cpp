@@ -0,0 +1,94 @@
+/**********************************/
+/*  FILE NAME: joint_palette.cpp  */
+/**********************************/
+#include "joint_palette.h"
+
+/* default constructor */
+JointPalette::JointPalette()
+    : texels()
+    , capacity(0)
+    , uploaded_bytes(0)
+    , dirty(false)
+    , buffer(0)
+    , texture(0)
+    , attached_buffer(0)
+    , base_texel(0)
+{ /* empty */ }
+
+/* copy constructor */
+JointPalette::JointPalette(const JointPalette& other)
+    : texels(other.texels)
+    , capacity(other.capacity)
+    , uploaded_bytes(other.uploaded_bytes)
+    , dirty(other.dirty)
+    , buffer(other.buffer)
+    , texture(other.texture)
+    , attached_buffer(other.attached_buffer)
+    , base_texel(other.base_texel)
+{ /* empty */ }
+
+/* function to remove every joint before the palette of a frame is packed */
+void JointPalette::Clear()
+{
+    texels.clear();
+    dirty = true;
+}
+
+/* function to add joint matrices, returns the texel offset of the first one */
+int JointPalette::Append(const std::vector<orca::affine<float>>& joint_matrices)
+{
+    const int offset = static_cast<int>(texels.size());
+    for(const auto& joint_matrix : joint_matrices)
+    {
+        texels.push_back(joint_matrix.data[0]);
+        texels.push_back(joint_matrix.data[1]);
+        texels.push_back(joint_matrix.data[2]);
+    }
+    dirty = true;
+    return offset;
+}
+
+/* function to add dual quaternions, returns the texel offset of the first one */
+/* (each texel is a quaternion stored as (r, x, y, z))                         */
+int JointPalette::Append(const std::vector<orca::dual_quaternion<float>>& joint_dual_quaternions)
+{
+    const int offset = static_cast<int>(texels.size());
+    for(const auto& dq : joint_dual_quaternions)
+    {
+        texels.push_back(orca::vec4<float>(dq.real.r, dq.real.x, dq.real.y, dq.real.z));
+        texels.push_back(orca::vec4<float>(dq.dual.r, dq.dual.x, dq.dual.y, dq.dual.z));
+    }
+    dirty = true;
+    return offset;
+}
+
+/* function to return the number of texels in the palette */
+std::size_t JointPalette::Size() const
+{
+    return texels.size();
+}
+
+/* function to return the joints packed since the last Clear() */
+const std::vector<orca::vec4<float>>& JointPalette::GetTexels() const
+{
+    return texels;
+}
+
+/* function to return the bytes sent by the last Upload() */
+std::size_t JointPalette::UploadedBytes() const
+{
+    return uploaded_bytes;
+}
+
+/* function to return the bytes of the buffer filled by Upload()      */
+/* (the ring written by Upload(ring, texels) belongs to its owner)    */
+std::size_t JointPalette::AllocatedBytes() const
+{
+    return sizeof(orca::vec4<float>) * capacity;
+}
+
+/* function to return the texel the offsets of Append() start from */
+int JointPalette::BaseTexel() const
+{
+    return base_texel;
+}
\ No newline at end of file
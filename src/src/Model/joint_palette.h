@@ -0,0 +1,67 @@
+/********************************/
+/*  FILE NAME: joint_palette.h  */
+/********************************/
+#ifndef _JOINT_PALETTE_H_
+#define _JOINT_PALETTE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <cstddef>
+#include <vector.hpp>
+#include <matrix.hpp>
+#include <dual_quaternion.hpp>
+
+class UploadRing;
+
+/******************************/
+/*  CLASS NAME: JointPalette  */
+/******************************/
+/* joint data of every skinned mesh of a frame, packed into one texture       */
+/* buffer (GL_RGBA32F). a joint matrix takes 3 texels (its rows) and a dual    */
+/* quaternion 2 texels (real, dual). each mesh addresses its own range with   */
+/* the texel offset returned by Append(), so there is no joint count limit.   */
+/* streamed through an UploadRing, the texture reads the ring's buffer and    */
+/* the offsets are relative to BaseTexel(). the texels streamed can be a copy */
+/* (PoseSnapshot) packed on another thread, the GL side never reads texels.   */
+class JointPalette
+{
+public:
+    JointPalette();
+    JointPalette(const JointPalette& other);
+
+public:
+    JointPalette& operator=(const JointPalette& rhs) = default;
+
+public:
+    void SetupPalette();
+    void CleanupPalette();
+    void Clear();
+    int Append(const std::vector<orca::affine<float>>& joint_matrices);
+    int Append(const std::vector<orca::dual_quaternion<float>>& joint_dual_quaternions);
+    void Upload();
+    void Upload(UploadRing& ring, const std::vector<orca::vec4<float>>& packed_texels);
+    void BindPalette();
+
+public:
+    std::size_t Size() const;
+    const std::vector<orca::vec4<float>>& GetTexels() const;
+    std::size_t UploadedBytes() const;
+    std::size_t AllocatedBytes() const;
+    int BaseTexel() const;
+
+private:
+    void UploadBuffer(const std::vector<orca::vec4<float>>& data);
+
+private:
+    std::vector<orca::vec4<float>> texels;
+    std::size_t capacity;
+    std::size_t uploaded_bytes;
+    bool dirty;
+    unsigned int buffer;
+    unsigned int texture;
+    unsigned int attached_buffer;   /* buffer read by the texture */
+    int base_texel;
+}; // class JointPalette
+#endif // !_JOINT_PALETTE_H_
\ No newline at end of file
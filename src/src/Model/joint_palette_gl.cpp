@@ -0,0 +1,160 @@
+/*************************************/
+/*  FILE NAME: joint_palette_gl.cpp  */
+/*************************************/
+#include "joint_palette.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstring>
+#include <algorithm>
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+#include "Renderer/upload_ring.h"
+
+/* function that returns true if a texture buffer can read a range of a buffer (GL 4.3 or ARB_texture_buffer_range) */
+static bool SupportsTextureBufferRange()
+{
+    return GLEW_VERSION_4_3 || GLEW_ARB_texture_buffer_range;
+}
+
+/* function that returns the alignment of the offset of a texture buffer range, at least a texel */
+static std::size_t TextureBufferOffsetAlignment()
+{
+    static const std::size_t alignment = []()
+    {
+        GLint value = 0;
+        glGetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &value);
+        return std::max<std::size_t>(static_cast<std::size_t>(value), sizeof(orca::vec4<float>));
+    }();
+    return alignment;
+}
+
+/* function that returns the most texels a texture buffer can read (65536 at least) */
+static std::size_t MaxTextureBufferTexels()
+{
+    static const std::size_t max_texels = []()
+    {
+        GLint value = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &value);
+        return static_cast<std::size_t>(value);
+    }();
+    return max_texels;
+}
+
+/* function to create the texture buffer of the palette */
+void JointPalette::SetupPalette()
+{
+    /* NOTE: a generated name is only a buffer object once bound, glTexBuffer refuses it before */
+    glGenBuffers(1, &buffer);
+    GLState::Get().BindBuffer(GL_TEXTURE_BUFFER, buffer);
+    glGenTextures(1, &texture);
+    GLState::Get().BindTexture(GL_TEXTURE_BUFFER, texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+    attached_buffer = buffer;
+    base_texel = 0;
+    capacity = 0;
+    dirty = true;
+}
+
+/* function to clean up the texture buffer of the palette */
+void JointPalette::CleanupPalette()
+{
+    GLState::Get().DeleteTexture(texture);
+    GLState::Get().DeleteBuffer(buffer);
+    texture = 0;
+    buffer = 0;
+    attached_buffer = 0;
+    capacity = 0;
+}
+
+/* function to upload the packed joints if they changed since the last upload */
+void JointPalette::Upload()
+{
+    uploaded_bytes = 0;
+    base_texel = 0;
+    if(attached_buffer != buffer)
+    {
+        GLState::Get().BindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+        attached_buffer = buffer;
+        dirty = true;
+    }
+    if(dirty == false || texels.empty() == true)
+        return;
+
+    UploadBuffer(texels);
+    dirty = false;
+}
+
+/* function to write packed joints into the current region of 'ring'             */
+/* NOTE: written every frame, since the region is reused FRAME_COUNT frames      */
+/*       later. the ring is flushed by the caller before the draws. the texture  */
+/*       reads only the range written (GL 4.3), else the whole ring if it fits   */
+/*       in GL_MAX_TEXTURE_BUFFER_SIZE, else the palette's own buffer is used.   */
+void JointPalette::Upload(UploadRing& ring, const std::vector<orca::vec4<float>>& packed_texels)
+{
+    uploaded_bytes = 0;
+    if(packed_texels.empty() == true)
+        return;
+
+    const std::size_t bytes = sizeof(orca::vec4<float>) * packed_texels.size();
+    const std::size_t ring_texels = ring.FrameSize() * UploadRing::FRAME_COUNT / sizeof(orca::vec4<float>);
+    if(SupportsTextureBufferRange() == true)
+    {
+        const UploadAllocation allocation = ring.Allocate(bytes, TextureBufferOffsetAlignment());
+        std::memcpy(allocation.data, packed_texels.data(), bytes);
+        base_texel = 0;
+
+        GLState::Get().BindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBufferRange(GL_TEXTURE_BUFFER, GL_RGBA32F, ring.GetBuffer(), static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(bytes));
+        attached_buffer = ring.GetBuffer();
+    }
+    else if(ring_texels <= MaxTextureBufferTexels())
+    {
+        const UploadAllocation allocation = ring.Allocate(bytes, sizeof(orca::vec4<float>));
+        std::memcpy(allocation.data, packed_texels.data(), bytes);
+        base_texel = static_cast<int>(allocation.offset / sizeof(orca::vec4<float>));
+
+        if(attached_buffer != ring.GetBuffer())
+        {
+            GLState::Get().BindTexture(GL_TEXTURE_BUFFER, texture);
+            glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, ring.GetBuffer());
+            attached_buffer = ring.GetBuffer();
+        }
+    }
+    else
+    {
+        base_texel = 0;
+        if(attached_buffer != buffer)
+        {
+            GLState::Get().BindTexture(GL_TEXTURE_BUFFER, texture);
+            glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+            attached_buffer = buffer;
+        }
+        UploadBuffer(packed_texels);
+        dirty = true;
+        return;
+    }
+
+    uploaded_bytes = bytes;
+}
+
+/* function to upload 'data' to the palette's own buffer                            */
+/* NOTE: the storage is orphaned first so that the draws of the previous frame that */
+/*       still read it do not stall the upload. it only grows, never shrinks.       */
+void JointPalette::UploadBuffer(const std::vector<orca::vec4<float>>& data)
+{
+    capacity = std::max(capacity, data.size());
+    const std::size_t bytes = sizeof(orca::vec4<float>) * data.size();
+    GLState::Get().BindBuffer(GL_TEXTURE_BUFFER, buffer);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(orca::vec4<float>) * capacity, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, bytes, data.data());
+    uploaded_bytes = bytes;
+}
+
+/* function to bind the palette to the active texture unit */
+void JointPalette::BindPalette()
+{
+    GLState::Get().BindTexture(GL_TEXTURE_BUFFER, texture);
+}
\ No newline at end of file
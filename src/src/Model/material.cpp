@@ -37,7 +37,7 @@ Material::Material()
 /* copy constructor */
 Material::Material(const Material& other)
     : alpha_mode(other.alpha_mode)
-    , alpha_cutoff(alpha_cutoff)
+    , alpha_cutoff(other.alpha_cutoff)
     , metallic_factor(other.metallic_factor)
     , roughness_factor(other.roughness_factor)
     , base_color_factor(other.base_color_factor)
@@ -0,0 +1,121 @@
+/*********************************/
+/*  FILE NAME: memory_usage.cpp  */
+/*********************************/
+#include "memory_usage.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstdio>
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+static constexpr int NUM_CATEGORIES = static_cast<int>(MEMORY_CATEGORY::COUNT);
+
+/* default constructor */
+MemoryUsage::MemoryUsage()
+    : cpu_bytes()
+    , gpu_bytes()
+{ /* empty */ }
+
+/* copy constructor */
+MemoryUsage::MemoryUsage(const MemoryUsage& other)
+    : cpu_bytes()
+    , gpu_bytes()
+{
+    for(int i = 0; i < NUM_CATEGORIES; ++i)
+    {
+        cpu_bytes[i] = other.cpu_bytes[i];
+        gpu_bytes[i] = other.gpu_bytes[i];
+    }
+}
+
+/* function to add the bytes of every category of 'rhs' */
+MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& rhs)
+{
+    for(int i = 0; i < NUM_CATEGORIES; ++i)
+    {
+        cpu_bytes[i] += rhs.cpu_bytes[i];
+        gpu_bytes[i] += rhs.gpu_bytes[i];
+    }
+    return *this;
+}
+
+void MemoryUsage::AddCpu(MEMORY_CATEGORY category, std::size_t bytes)
+{
+    cpu_bytes[static_cast<int>(category)] += bytes;
+}
+
+void MemoryUsage::AddGpu(MEMORY_CATEGORY category, std::size_t bytes)
+{
+    gpu_bytes[static_cast<int>(category)] += bytes;
+}
+
+std::size_t MemoryUsage::Cpu(MEMORY_CATEGORY category) const
+{
+    return cpu_bytes[static_cast<int>(category)];
+}
+
+std::size_t MemoryUsage::Gpu(MEMORY_CATEGORY category) const
+{
+    return gpu_bytes[static_cast<int>(category)];
+}
+
+std::size_t MemoryUsage::TotalCpu() const
+{
+    std::size_t total = 0;
+    for(int i = 0; i < NUM_CATEGORIES; ++i)
+        total += cpu_bytes[i];
+    return total;
+}
+
+std::size_t MemoryUsage::TotalGpu() const
+{
+    std::size_t total = 0;
+    for(int i = 0; i < NUM_CATEGORIES; ++i)
+        total += gpu_bytes[i];
+    return total;
+}
+
+/* function to return a table of the categories and the totals, in KiB */
+std::string MemoryUsage::Report() const
+{
+    char line[128];
+    std::string report;
+    std::snprintf(line, sizeof(line), "%-11s %12s %12s\n", "[KiB]", "cpu", "gpu");
+    report += line;
+    for(int i = 0; i < NUM_CATEGORIES; ++i)
+    {
+        std::snprintf(line, sizeof(line), "%-11s %12.1f %12.1f\n", MemoryCategoryName(static_cast<MEMORY_CATEGORY>(i)),
+                      static_cast<double>(cpu_bytes[i]) / 1024.0, static_cast<double>(gpu_bytes[i]) / 1024.0);
+        report += line;
+    }
+    std::snprintf(line, sizeof(line), "%-11s %12.1f %12.1f\n", "total",
+                  static_cast<double>(TotalCpu()) / 1024.0, static_cast<double>(TotalGpu()) / 1024.0);
+    report += line;
+    return report;
+}
+
+
+/* function to return the name of 'category' as printed in the reports */
+const char* MemoryCategoryName(MEMORY_CATEGORY category)
+{
+    switch (category)
+    {
+    case MEMORY_CATEGORY::VERTICES:
+        return "vertices";
+    case MEMORY_CATEGORY::INDICES:
+        return "indices";
+    case MEMORY_CATEGORY::TEXTURES:
+        return "textures";
+    case MEMORY_CATEGORY::ANIMATIONS:
+        return "animations";
+    case MEMORY_CATEGORY::SKINS:
+        return "skins";
+    case MEMORY_CATEGORY::PALETTES:
+        return "palettes";
+    default:
+        return "unknown";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*******************************/
+/*  FILE NAME: memory_usage.h  */
+/*******************************/
+#ifndef _MEMORY_USAGE_H_
+#define _MEMORY_USAGE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**************************************/
+/*  ENUM CLASS NAME: MEMORY_CATEGORY  */
+/**************************************/
+enum class MEMORY_CATEGORY
+{
+    VERTICES,
+    INDICES,
+    TEXTURES,       /* images, mip levels being streamed, texture storage */
+    ANIMATIONS,     /* sampler keys and channels                          */
+    SKINS,          /* joint lists and inverse bind matrices              */
+    PALETTES,       /* joints of the current pose and their packed texels */
+    COUNT
+}; // enum class MEMORY_CATEGORY
+
+/*****************************/
+/*  CLASS NAME: MemoryUsage  */
+/*****************************/
+/* CPU and GPU bytes held by the assets of a model, by category. the CPU  */
+/* bytes are the capacities of the containers, the GPU bytes the storage  */
+/* allocated for the buffers and textures (as requested, drivers may pad) */
+class MemoryUsage
+{
+public:
+    MemoryUsage();
+    MemoryUsage(const MemoryUsage& other);
+
+public:
+    MemoryUsage& operator+=(const MemoryUsage& rhs);
+
+public:
+    void AddCpu(MEMORY_CATEGORY category, std::size_t bytes);
+    void AddGpu(MEMORY_CATEGORY category, std::size_t bytes);
+
+public:
+    std::size_t Cpu(MEMORY_CATEGORY category) const;
+    std::size_t Gpu(MEMORY_CATEGORY category) const;
+    std::size_t TotalCpu() const;
+    std::size_t TotalGpu() const;
+    std::string Report() const;
+
+private:
+    std::size_t cpu_bytes[static_cast<int>(MEMORY_CATEGORY::COUNT)];
+    std::size_t gpu_bytes[static_cast<int>(MEMORY_CATEGORY::COUNT)];
+}; // class MemoryUsage
+
+const char* MemoryCategoryName(MEMORY_CATEGORY category);
+
+/* function to return the bytes allocated by 'values' (its capacity, not its size) */
+template<typename T>
+std::size_t VectorBytes(const std::vector<T>& values)
+{
+    return sizeof(T) * values.capacity();
+}
+#endif // !_MEMORY_USAGE_H_
\ No newline at end of file
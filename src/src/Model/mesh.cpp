@@ -6,7 +6,7 @@
 /**************/
 /*  INCLUDES  */
 /**************/
-#include <GL/glew.h>
+#include <utility>
 #include <vector_functions.hpp>
 #include <matrix_functions.hpp>
 
@@ -18,80 +18,120 @@ Mesh::Mesh()
     , material_id()
     , matrix()
     , joint_matrices()
+    , joint_dual_quaternions()
+    , joint_offset()
+    , first_vertex(0)
+    , vertex_count(0)
+    , local_bounds()
+    , local_sphere()
+    , joint_bounds()
+    , bounds()
+    , visible(true)
     , vao()
-    , vbo()
-    , ebo()
 { 
-    for(unsigned int i = 0; i < MAX_NUM_JOINTS; ++i)
-        joint_matrices[i] = orca::Identity(joint_matrices[i]);
-
     material_id = -1;
+    joint_offset = 0;
     vao = 0;
-    vbo = 0;
-    ebo = 0;
 }
 
-/* copy constructor */
-Mesh::Mesh(const Mesh& other)
-    : name(other.name)
-    , vertices(other.vertices)
-    , indices(other.indices)
+/* move constructor */
+/* (the vertex array is taken from 'other') */
+Mesh::Mesh(Mesh&& other) noexcept
+    : name(std::move(other.name))
+    , vertices(std::move(other.vertices))
+    , indices(std::move(other.indices))
     , material_id(other.material_id)
     , matrix(other.matrix)
-    , joint_matrices(other.joint_matrices)
-    , vao(other.vao)
-    , vbo(other.vbo)
-    , ebo(other.ebo)
+    , joint_matrices(std::move(other.joint_matrices))
+    , joint_dual_quaternions(std::move(other.joint_dual_quaternions))
+    , joint_offset(other.joint_offset)
+    , first_vertex(other.first_vertex)
+    , vertex_count(other.vertex_count)
+    , local_bounds(other.local_bounds)
+    , local_sphere(other.local_sphere)
+    , joint_bounds(std::move(other.joint_bounds))
+    , bounds(other.bounds)
+    , visible(other.visible)
+    , vao(std::exchange(other.vao, 0U))
 { /* empty */ }
 
-/* set the mesh data to be available in OpenGL */
-void Mesh::SetupMesh()
+/* move assignment operator */
+/* (the vertex arrays are swapped, 'rhs' cleans up the old one) */
+Mesh& Mesh::operator=(Mesh&& rhs) noexcept
 {
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
-
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, position)));
-
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, normal)));
-
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, texcoord)));
-
-    glEnableVertexAttribArray(3);
-    glVertexAttribIPointer(3, 4, GL_UNSIGNED_INT, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, joint)));
-
-    glEnableVertexAttribArray(4);
-    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, weight)));
-
-    glGenVertexArrays(1, &ebo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(), indices.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    if(this == &rhs)
+        return *this;
+
+    name = std::move(rhs.name);
+    vertices = std::move(rhs.vertices);
+    indices = std::move(rhs.indices);
+    material_id = rhs.material_id;
+    matrix = rhs.matrix;
+    joint_matrices = std::move(rhs.joint_matrices);
+    joint_dual_quaternions = std::move(rhs.joint_dual_quaternions);
+    joint_offset = rhs.joint_offset;
+    first_vertex = rhs.first_vertex;
+    vertex_count = rhs.vertex_count;
+    local_bounds = rhs.local_bounds;
+    local_sphere = rhs.local_sphere;
+    joint_bounds = std::move(rhs.joint_bounds);
+    bounds = rhs.bounds;
+    visible = rhs.visible;
+    std::swap(vao, rhs.vao);
+    return *this;
 }
 
-/* clean up the mesh data that was set up */
-void Mesh::CleanupMesh()
+/* function to copy the mesh for an instance of its scene (see Scene::Instantiate) */
+/* NOTE: the vertices, indices and vertex array stay with this mesh                */
+Mesh Mesh::MakeInstance() const
 {
-    glDeleteBuffers(1, &ebo);
-    glDeleteBuffers(1, &vbo);
-    glDeleteVertexArrays(1, &vao);
+    Mesh instance;
+    instance.name = name;
+    instance.material_id = material_id;
+    instance.matrix = matrix;
+    instance.joint_matrices = joint_matrices;
+    instance.joint_dual_quaternions = joint_dual_quaternions;
+    instance.joint_offset = joint_offset;
+    instance.first_vertex = first_vertex;
+    instance.vertex_count = vertex_count;
+    instance.local_bounds = local_bounds;
+    instance.local_sphere = local_sphere;
+    instance.joint_bounds = joint_bounds;
+    instance.bounds = bounds;
+    instance.visible = visible;
+    return instance;
 }
 
-/* render the mesh data */
-void Mesh::Render(unsigned int shader_program, bool is_animation)
+/* function to compute the bounds of the loaded vertices                       */
+/* NOTE: 'local_bounds' set from the accessor min/max is kept. a vertex counts */
+/*       in the box of every joint it has a weight for.                        */
+void Mesh::SetupBounds()
 {
-    if(is_animation == true)
-        glUniformMatrix4fv(glGetUniformLocation(shader_program, "bone_matrix"), MAX_NUM_JOINTS, GL_FALSE, joint_matrices[0]);
-
-    glBindVertexArray(vao);
-    glDrawArrays(GL_TRIANGLES, 0, indices.size());
-    glBindVertexArray(0);
+    if(local_bounds.IsEmpty() == true)
+    {
+        for(const auto& vertex : vertices)
+            local_bounds.Extend(vertex.position);
+    }
+    local_sphere = MakeBoundingSphere(local_bounds);
+
+    joint_bounds.clear();
+    for(const auto& vertex : vertices)
+    {
+        for(unsigned int i = 0; i < 4; ++i)
+        {
+            if(vertex.weight[i] <= 0.0f)
+                continue;
+            if(vertex.joint[i] >= joint_bounds.size())
+                joint_bounds.resize(vertex.joint[i] + 1);
+            joint_bounds[vertex.joint[i]].Extend(vertex.position);
+        }
+    }
+    bounds = local_bounds;
 }
+
+/* function to return the vertex array object of the mesh */
+/* (drawn by RenderQueue with 'vertex_count' vertices)    */
+unsigned int Mesh::GetVertexArray() const
+{
+    return vao;
+}
\ No newline at end of file
@@ -9,26 +9,45 @@
 /**************/
 #include <string>
 #include <vector>
-#include <array>
+#include <cstddef>
 #include <vector.hpp>
 #include <matrix.hpp>
+#include <dual_quaternion.hpp>
 #include "vertex.h"
+#include "bounds.h"
 
-constexpr unsigned int MAX_NUM_JOINTS = 128U;
+/************************************/
+/*  ENUM CLASS NAME: SKINNING_TYPE  */
+/************************************/
+enum class SKINNING_TYPE
+{
+    NONE,
+    LINEAR,             /* 3 palette texels (3x4 matrix) per joint      */
+    DUAL_QUATERNION     /* 2 palette texels (dual quaternion) per joint */
+}; // enum class SKINNING_TYPE
 
 /**********************/
 /*  CLASS NAME: Mesh  */
 /**********************/
+/* move-only: it owns its vertex array, a moved-from mesh has none left to */
+/* clean up (or the one of the mesh it was assigned over)                  */
 class Mesh
 {
 public:
     Mesh();
-    Mesh(const Mesh& other);
+    Mesh(const Mesh& other) = delete;
+    Mesh(Mesh&& other) noexcept;
+
+public:
+    Mesh& operator=(const Mesh& rhs) = delete;
+    Mesh& operator=(Mesh&& rhs) noexcept;
 
 public:
-    void SetupMesh();
+    void SetupMesh(unsigned int vertex_buffer);
     void CleanupMesh();
-    void Render(unsigned int shader_program, bool is_animation);
+    void SetupBounds();
+    Mesh MakeInstance() const;
+    unsigned int GetVertexArray() const;
 
 public:
     std::string name;
@@ -36,12 +55,22 @@ public:
     std::vector<unsigned int> indices;
 
     int material_id;
-    orca::mat4<float> matrix;
-    std::array<orca::mat4<float>, MAX_NUM_JOINTS> joint_matrices;
+    orca::affine<float> matrix;
+    std::vector<orca::affine<float>> joint_matrices;
+    std::vector<orca::dual_quaternion<float>> joint_dual_quaternions;
+    int joint_offset;
+    unsigned int first_vertex;              /* first vertex in the shared vertex buffer */
+    unsigned int vertex_count;              /* vertices set up for the draws, kept once the CPU copy is released */
+
+    BoundingBox local_bounds;               /* vertices as loaded (accessor min/max if present) */
+    BoundingSphere local_sphere;
+    std::vector<BoundingBox> joint_bounds;  /* bind space vertices influenced by each joint     */
+    BoundingBox bounds;                     /* vertices as skinned by the current joints        */
+    bool visible;                           /* result of the last Model::Cull()                 */
 
 private:
     unsigned int vao;
-    unsigned int vbo;
-    unsigned int ebo;
 }; // class Mesh
+
+void SetupVertexAttributes(std::size_t base_offset);
 #endif // !_MESH_H_
\ No newline at end of file
@@ -0,0 +1,51 @@
+/****************************/
+/*  FILE NAME: mesh_gl.cpp  */
+/****************************/
+#include "mesh.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+
+/* set the mesh data to be available in OpenGL                                     */
+/* NOTE: the vertices are in 'vertex_buffer' from 'first_vertex' (GeometryBuffer). */
+/*       the loader expands them from the indices, so no index buffer is made      */
+void Mesh::SetupMesh(unsigned int vertex_buffer)
+{
+    GLState& state = GLState::Get();
+
+    glGenVertexArrays(1, &vao);
+    state.BindVertexArray(vao);
+
+    state.BindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+    SetupVertexAttributes(sizeof(Vertex) * first_vertex);
+    vertex_count = static_cast<unsigned int>(vertices.size());
+}
+
+/* clean up the mesh data that was set up */
+void Mesh::CleanupMesh()
+{
+    GLState::Get().DeleteVertexArray(vao);
+}
+
+/* function to point the vertex attributes (locations 0 to 4) of the bound vertex */
+/* array at the Vertex data of the bound array buffer, from 'base_offset' bytes   */
+void SetupVertexAttributes(std::size_t base_offset)
+{
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(base_offset + offsetof(Vertex, position)));
+
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(base_offset + offsetof(Vertex, normal)));
+
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(base_offset + offsetof(Vertex, texcoord)));
+
+    glEnableVertexAttribArray(3);
+    glVertexAttribIPointer(3, 4, GL_UNSIGNED_INT, sizeof(Vertex), reinterpret_cast<void*>(base_offset + offsetof(Vertex, joint)));
+
+    glEnableVertexAttribArray(4);
+    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(base_offset + offsetof(Vertex, weight)));
+}
\ No newline at end of file
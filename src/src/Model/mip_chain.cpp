@@ -0,0 +1,208 @@
+/******************************/
+/*  FILE NAME: mip_chain.cpp  */
+/******************************/
+#include "mip_chain.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <algorithm>
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+/* entries of the linear to sRGB table (12 bits, below half a step of 8 bit sRGB) */
+static constexpr int LINEAR_TABLE_SIZE = 4096;
+
+/* function to return the sRGB to linear table of the 256 byte values */
+static const float* SrgbToLinearTable()
+{
+    static const std::vector<float> table = []()
+    {
+        std::vector<float> values(256);
+        for(int i = 0; i < 256; ++i)
+        {
+            const float c = static_cast<float>(i) / 255.0f;
+            values[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table.data();
+}
+
+/* function to return the linear to sRGB byte table, indexed by linear * (LINEAR_TABLE_SIZE - 1) */
+static const unsigned char* LinearToSrgbTable()
+{
+    static const std::vector<unsigned char> table = []()
+    {
+        std::vector<unsigned char> values(LINEAR_TABLE_SIZE);
+        for(int i = 0; i < LINEAR_TABLE_SIZE; ++i)
+        {
+            const float l = static_cast<float>(i) / static_cast<float>(LINEAR_TABLE_SIZE - 1);
+            const float c = (l <= 0.0031308f) ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+            values[i] = static_cast<unsigned char>(std::min(255.0f, c * 255.0f + 0.5f));
+        }
+        return values;
+    }();
+    return table.data();
+}
+
+/* default constructor */
+MipLevel::MipLevel()
+    : width(0)
+    , height(0)
+    , data()
+{ /* empty */ }
+
+/* copy constructor */
+MipLevel::MipLevel(const MipLevel& other)
+    : width(other.width)
+    , height(other.height)
+    , data(other.data)
+{ /* empty */ }
+
+
+/* default constructor */
+MipChain::MipChain()
+    : image(nullptr)
+    , levels()
+{ /* empty */ }
+
+/* copy constructor */
+MipChain::MipChain(const MipChain& other)
+    : image(other.image)
+    , levels(other.levels)
+{ /* empty */ }
+
+/* function to build every level below level 0, each from the one above it */
+void MipChain::Build(const Image& image, bool srgb)
+{
+    this->image = &image;
+    levels.resize(std::max(NumMipLevels(image.width, image.height) - 1, 0));
+
+    for(std::size_t i = 0; i < levels.size(); ++i)
+    {
+        const int level = static_cast<int>(i);
+        DownsampleLevel(Data(level), Width(level), Height(level), image.component, srgb, levels[i]);
+    }
+}
+
+/* function to release the levels once they are uploaded */
+void MipChain::Clear()
+{
+    image = nullptr;
+    std::vector<MipLevel>().swap(levels);
+}
+
+int MipChain::NumLevels() const
+{
+    return (image != nullptr) ? static_cast<int>(levels.size()) + 1 : 0;
+}
+
+int MipChain::Width(int level) const
+{
+    return (level == 0) ? image->width : levels[level - 1].width;
+}
+
+int MipChain::Height(int level) const
+{
+    return (level == 0) ? image->height : levels[level - 1].height;
+}
+
+/* function to return the bytes of a row of a level (rows are tightly packed) */
+std::size_t MipChain::RowBytes(int level) const
+{
+    return static_cast<std::size_t>(Width(level)) * static_cast<std::size_t>(image->component);
+}
+
+const unsigned char* MipChain::Data(int level) const
+{
+    return (level == 0) ? image->data.data() : levels[level - 1].data.data();
+}
+
+/* function to return the bytes of the levels built (level 0 is the image's) */
+std::size_t MipChain::Bytes() const
+{
+    std::size_t bytes = 0;
+    for(const auto& level : levels)
+        bytes += level.data.capacity();
+    return bytes;
+}
+
+
+/* function to return the number of levels down to 1x1 */
+int NumMipLevels(int width, int height)
+{
+    int num_levels = 1;
+    for(int size = std::max(width, height); size > 1; size /= 2)
+        num_levels += 1;
+    return num_levels;
+}
+
+/* function to make the next level of 'source' with a 2x2 box filter                   */
+/* NOTE: the last texel of an odd row or column (above 1) averages 3 source texels, so */
+/*       no source texel is dropped. a 1 texel row or column is averaged with itself.  */
+/*       the alpha channel (4th) is never sRGB.                                        */
+void DownsampleLevel(const unsigned char* source, int width, int height, int component, bool srgb, MipLevel& target)
+{
+    target.width = std::max(width / 2, 1);
+    target.height = std::max(height / 2, 1);
+    target.data.resize(static_cast<std::size_t>(target.width) * target.height * component);
+
+    const float* to_linear = SrgbToLinearTable();
+    const unsigned char* to_srgb = LinearToSrgbTable();
+    const int color_channels = (component == 4) ? 3 : component;
+    const std::size_t row_bytes = static_cast<std::size_t>(width) * component;
+    const bool odd_width = (width > 1 && width % 2 == 1);
+    const bool odd_height = (height > 1 && height % 2 == 1);
+
+    unsigned char* output = target.data.data();
+    for(int y = 0; y < target.height; ++y)
+    {
+        const unsigned char* rows[3];
+        rows[0] = source + row_bytes * std::min(2 * y, height - 1);
+        rows[1] = source + row_bytes * std::min(2 * y + 1, height - 1);
+        rows[2] = source + row_bytes * std::min(2 * y + 2, height - 1);
+        const int num_rows = (odd_height == true && y == target.height - 1) ? 3 : 2;
+        for(int x = 0; x < target.width; ++x)
+        {
+            int columns[3];
+            columns[0] = std::min(2 * x, width - 1) * component;
+            columns[1] = std::min(2 * x + 1, width - 1) * component;
+            columns[2] = std::min(2 * x + 2, width - 1) * component;
+            const int num_columns = (odd_width == true && x == target.width - 1) ? 3 : 2;
+            const int num_texels = num_rows * num_columns;
+            for(int c = 0; c < component; ++c)
+            {
+                const bool linear = (srgb == true && c < color_channels);
+                if(num_texels == 4 && linear == true)
+                {
+                    const float sum = to_linear[rows[0][columns[0] + c]] + to_linear[rows[0][columns[1] + c]] + to_linear[rows[1][columns[0] + c]] + to_linear[rows[1][columns[1] + c]];
+                    *output++ = to_srgb[static_cast<int>(sum * 0.25f * (LINEAR_TABLE_SIZE - 1) + 0.5f)];
+                }
+                else if(num_texels == 4)
+                {
+                    const int sum = rows[0][columns[0] + c] + rows[0][columns[1] + c] + rows[1][columns[0] + c] + rows[1][columns[1] + c];
+                    *output++ = static_cast<unsigned char>((sum + 2) / 4);
+                }
+                else if(linear == true)
+                {
+                    float sum = 0.0f;
+                    for(int row = 0; row < num_rows; ++row)
+                        for(int column = 0; column < num_columns; ++column)
+                            sum += to_linear[rows[row][columns[column] + c]];
+                    *output++ = to_srgb[static_cast<int>(sum / num_texels * (LINEAR_TABLE_SIZE - 1) + 0.5f)];
+                }
+                else
+                {
+                    int sum = 0;
+                    for(int row = 0; row < num_rows; ++row)
+                        for(int column = 0; column < num_columns; ++column)
+                            sum += rows[row][columns[column] + c];
+                    *output++ = static_cast<unsigned char>((sum + num_texels / 2) / num_texels);
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+/****************************/
+/*  FILE NAME: mip_chain.h  */
+/****************************/
+#ifndef _MIP_CHAIN_H_
+#define _MIP_CHAIN_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <cstddef>
+#include "image.h"
+
+/**************************/
+/*  CLASS NAME: MipLevel  */
+/**************************/
+class MipLevel
+{
+public:
+    MipLevel();
+    MipLevel(const MipLevel& other);
+
+public:
+    int width;
+    int height;
+    std::vector<unsigned char> data;
+}; // class MipLevel
+
+/**************************/
+/*  CLASS NAME: MipChain  */
+/**************************/
+/* every mip level of an 8 bit image, built on the CPU (no OpenGL). level 0 */
+/* is the image itself and is not copied, so the image must outlive it.     */
+/* color channels of sRGB images are averaged in linear light, the alpha    */
+/* channel and the channels of data images (normals, roughness) as stored.  */
+class MipChain
+{
+public:
+    MipChain();
+    MipChain(const MipChain& other);
+
+public:
+    void Build(const Image& image, bool srgb);
+    void Clear();
+
+public:
+    int NumLevels() const;
+    int Width(int level) const;
+    int Height(int level) const;
+    std::size_t RowBytes(int level) const;
+    const unsigned char* Data(int level) const;
+    std::size_t Bytes() const;
+
+private:
+    const Image* image;
+    std::vector<MipLevel> levels;   /* levels 1 to NumLevels() - 1 */
+}; // class MipChain
+
+int NumMipLevels(int width, int height);
+void DownsampleLevel(const unsigned char* source, int width, int height, int component, bool srgb, MipLevel& target);
+#endif // !_MIP_CHAIN_H_
\ No newline at end of file
@@ -6,1039 +6,421 @@
 /**************/
 /*  INCLUDES  */
 /**************/
-#define TINYGLTF_IMPLEMENTATION
-#define STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include <tiny_gltf.h>
-#include <vector_functions.hpp>
-#include <matrix_functions.hpp>
-#include <quaternion_functions.hpp>
-
-/*************************/
-/*  FUNCTION PROTOTYPES  */
-/*************************/
-bool IsBinaryFile(const std::string& file);
-void LoadglTFModel(tinygltf::Model& gltf_model, const std::string& file);
-Mesh LoadglTFMesh(const tinygltf::Model& gltf_model, const tinygltf::Mesh& gltf_mesh);
-void LoadglTFNode(const tinygltf::Model& gltf_model, const tinygltf::Node& gltf_node, int parent_id, int current_id, std::map<int, Node>& nodes);
-Skin LoadglTFSkin(const tinygltf::Model& gltf_model, const tinygltf::Skin& gltf_skin);
-Animation LoadglTFAnimation(const tinygltf::Model& gltf_model, const tinygltf::Animation& gltf_animation);
-Texture LoadglTFTexture(const tinygltf::Model& gltf_model, const tinygltf::Texture& gltf_texture);
-Material LoadglTFMaterial(const tinygltf::Model& gltf_model, const tinygltf::Material& gltf_material);
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+#include "Profiler/profiler.h"
 
+/* constructor */
+/* (the file is loaded through the asset cache with the default options) */
+Model::Model(const std::string& directory, const std::string& filename)
+    : Model(ModelAsset::Load(directory + '/' + filename, AssetLoadOptions()))
+{ /* empty */ }
 
-/* a function that checks if a file in glTF format is in binary format */
-/* returns ture if it is in binary format                              */
-bool IsBinaryFile(const std::string& file)
+/* constructor */
+Model::Model(std::shared_ptr<ModelAsset> asset)
+    : asset(std::move(asset))
+    , scene()
+    , joint_palette()
+    , render_program(0)
+    , joint_palette_location(-1)
+    , joint_offset_location(-1)
+    , crowd_program(0)
+    , crowd_offset_location(-1)
+    , crowd_palette_location(-1)
+    , frame_stride_location(-1)
+    , frames_per_second_location(-1)
+    , time_location(-1)
+    , render_queue()
+    , frame_arena()
+    , indirect_list()
+    , indirect_stats()
+    , rendered_indirect(false)
+    , visible_meshes(0)
+    , culled_meshes(0)
 {
-    bool binary = false;
-    std::size_t ext_pos = file.rfind('.', file.length());
-    if(ext_pos != std::string::npos)
-    {
-        binary = (file.substr(ext_pos + 1, file.length() - ext_pos) == "glb");
-    }
-    return binary;
+    if(this->asset == nullptr)
+        throw std::runtime_error("model error: no asset to draw.");
+
+    scene.Instantiate(this->asset->GetScene());
+    SetupModel();
 }
 
-/* function to load glTF model instance from glTF format file */
-void LoadglTFModel(tinygltf::Model& gltf_model, const std::string& file)
+/* destructor */
+Model::~Model()
 {
-    std::string error;
-    std::string warning;
-    tinygltf::TinyGLTF gltf_loader;
-    bool is_loaded;
-
-    /* load from glTF file */
-    if(IsBinaryFile(file) == true)
-        is_loaded = gltf_loader.LoadBinaryFromFile(&gltf_model, &error, &warning, file);
-    else
-        is_loaded = gltf_loader.LoadASCIIFromFile(&gltf_model, &error, &warning, file);
-
-    /* check if it is loaded */
-    if(is_loaded == false)
-        throw std::runtime_error("Failed to load glTF file(" + file + "), error: " + error);
-
-    /* check for warning messages */
-    if(warning.empty() == false)
-        std::cout << "glTF warning: " << warning << std::endl;
+    CleanupModel();
 }
 
-/* a function that loads mesh data */
-/* return the loaded mesh          */
-Mesh LoadglTFMesh(const tinygltf::Model& gltf_model, const tinygltf::Mesh& gltf_mesh)
+/* function to set up the GL resources of the model itself (the asset has the rest) */
+void Model::SetupModel()
 {
-    Mesh mesh;
-    mesh.name = gltf_mesh.name;
-
-    /* NOTE: Assume that there is only one primitive in a mesh */
-    /* TODO: Modify it to work on more than one primitive. */
-    for(const auto& primitive : gltf_mesh.primitives)
-    {
-        /* save material id */
-        mesh.material_id = primitive.material;
-
-        /* load indices data */
-        {
-            const auto& accessor = gltf_model.accessors[primitive.indices];
-            const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-            const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-            const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
-            const auto byte_stride = accessor.ByteStride(buffer_view);
-            const auto count = accessor.count;
-
-            mesh.indices.clear();
-            mesh.indices.reserve(count);
-            if(accessor.type == TINYGLTF_TYPE_SCALAR)
-            {
-                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_BYTE
-                    || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE)
-                {
-                    for(std::size_t i = 0; i < count; ++i)
-                        mesh.indices.emplace_back(*(reinterpret_cast<const char*>(data_address + i * byte_stride)));
-                }
-                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_SHORT
-                        || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
-                {
-                    for(std::size_t i = 0; i < count; ++i)
-                        mesh.indices.emplace_back(*(reinterpret_cast<const short*>(data_address + i * byte_stride)));
-                }
-                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_INT
-                        || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT)
-                {
-                    for(std::size_t i = 0; i < count; ++i)
-                        mesh.indices.emplace_back(*(reinterpret_cast<const int*>(data_address + i * byte_stride)));
-                }
-                else { throw std::runtime_error("Undefined indices component type."); }
-            }
-            else { throw std::runtime_error("Undefined indices type."); }
-        }
-
-
-        if(mesh.indices.size() > 0)
-        {
-            /* converts an indices array into the 'TRIANGLES' mode indices array */
-            if(primitive.mode == TINYGLTF_MODE_TRIANGLES) { /* empty */ }
-            else if(primitive.mode == TINYGLTF_MODE_TRIANGLE_FAN)
-            {
-                auto triangle_fan = std::move(mesh.indices);
-                mesh.indices.clear();
-
-                for(std::size_t i = 2; i < triangle_fan.size(); ++i)
-                {
-                    mesh.indices.push_back(triangle_fan[0]);
-                    mesh.indices.push_back(triangle_fan[i - 1]);
-                    mesh.indices.push_back(triangle_fan[i - 0]);
-                }
-            }
-            else if(primitive.mode == TINYGLTF_MODE_TRIANGLE_STRIP)
-            {
-                auto triangle_strip = std::move(mesh.indices);
-                mesh.indices.clear();
-
-                for(std::size_t i = 2; i < triangle_strip.size(); ++i)
-                {
-                    mesh.indices.push_back(triangle_strip[i - 2]);
-                    mesh.indices.push_back(triangle_strip[i - 1]);
-                    mesh.indices.push_back(triangle_strip[i - 0]);
-                }
-            }
-            else { throw std::runtime_error("Undefined primitive mode."); }
-        }
-
-
-        mesh.vertices.resize(mesh.indices.size());
-        for(const auto& attribute : primitive.attributes)
-        {
-            /* load vertices data */
-            /* NOTE: render witout using an index buffer      */
-            /* TODO: change to use index buffer for rendering */
-            {
-                const auto& accessor = gltf_model.accessors[attribute.second];
-                const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-                const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-                const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
-                const auto byte_stride = accessor.ByteStride(buffer_view);
-
-                if(attribute.first == "POSITION")
-                {
-                    if(accessor.type == TINYGLTF_TYPE_VEC3)
-                    {
-                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].position.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].position.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].position.z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + face * byte_stride));
-                            }
-                        }
-                        else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].position.x = *(reinterpret_cast<const double*>(data_address + 0 *sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].position.y = *(reinterpret_cast<const double*>(data_address + 1 *sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].position.z = *(reinterpret_cast<const double*>(data_address + 2 *sizeof(double) + face * byte_stride));
-                            }
-                        }
-                        else { throw std::runtime_error("Undefined \'POSITION\' attribute component type."); }
-                    }  
-                    else { throw std::runtime_error("Undefined \'POSITION\' attribute type."); }
-                } // endif 'POSITION'
-                else if(attribute.first == "NORMAL")
-                {
-                    if(accessor.type == TINYGLTF_TYPE_VEC3)
-                    {
-                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].normal.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].normal.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].normal.z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + face * byte_stride));
-                            }
-                        }
-                        else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].normal.x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].normal.y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].normal.z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + face * byte_stride));
-                            }
-                        }
-                        else { throw std::runtime_error("Undefined \'NORMAL\' attribute component type."); }
-                    }
-                    else { throw std::runtime_error("Undefined \'NORMAL\' attribute type."); }
-                } // endif 'NORMAL'
-                else if(attribute.first == "TEXCOORD_0")
-                {
-                    if(accessor.type == TINYGLTF_TYPE_VEC2)
-                    {
-                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].texcoord.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].texcoord.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
-                            }
-                        }
-                        else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].texcoord.x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].texcoord.y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + face * byte_stride));
-                            }
-                        }
-                        else { throw std::runtime_error("Undefined \'TEXCOORD_0\' attribute component type."); }
-                    }
-                    else { throw std::runtime_error("Undefined \'TEXCOORD_0\' attribute type."); }
-                } // endif 'TEXCOORD_0'
-                else if(attribute.first == "JOINTS_0")
-                {
-                    if(accessor.type == TINYGLTF_TYPE_VEC4)
-                    {
-                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_SHORT
-                            || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
-                        {   
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].joint.x = *(reinterpret_cast<const short*>(data_address + 0 * sizeof(short) + face * byte_stride));
-                                mesh.vertices[i].joint.y = *(reinterpret_cast<const short*>(data_address + 1 * sizeof(short) + face * byte_stride));
-                                mesh.vertices[i].joint.z = *(reinterpret_cast<const short*>(data_address + 2 * sizeof(short) + face * byte_stride));
-                                mesh.vertices[i].joint.w = *(reinterpret_cast<const short*>(data_address + 3 * sizeof(short) + face * byte_stride));
-                            }
-                        }
-                        else { throw std::runtime_error("Undefined \'JOINTS_0\' attribute component type."); }
-                    }
-                    else { throw std::runtime_error("Undefined \'JOINTS_0\' attribute type."); }
-                } // endif 'JOINTS_0'
-                else if(attribute.first == "WEIGHTS_0")
-                {
-                    if(accessor.type == TINYGLTF_TYPE_VEC4)
-                    {
-                        if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].weight.x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].weight.y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].weight.z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + face * byte_stride));
-                                mesh.vertices[i].weight.w = *(reinterpret_cast<const float*>(data_address + 3 * sizeof(float) + face * byte_stride));
-                            }
-                        }
-                        else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                        {
-                            for(std::size_t i = 0; i < mesh.indices.size(); ++i)
-                            {
-                                auto face = mesh.indices[i];
-                                mesh.vertices[i].weight.x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].weight.y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].weight.z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + face * byte_stride));
-                                mesh.vertices[i].weight.w = *(reinterpret_cast<const double*>(data_address + 3 * sizeof(double) + face * byte_stride));
-                            }
-                        }
-                        else { throw std::runtime_error("Undefined \'WEIGHTS_0\' attribute type."); }
-                    }
-                    else { throw std::runtime_error("Undefined \'WEIGHTS_0\' attribute type."); }
-                } // endif 'WEIGHTS_0'
-            }
-        } // for each attribute in primitive
-    } // for each primitive in glTF mesh
-
-    return mesh;
+    joint_palette.SetupPalette();
 }
 
-/* recursively load node data */
-void LoadglTFNode(const tinygltf::Model& gltf_model, const tinygltf::Node& gltf_node, int parent_id, int current_id, std::map<int, Node>& nodes)
+/* function to clean up the GL resources of the model itself            */
+/* NOTE: those of the asset are freed with the last model holding it    */
+void Model::CleanupModel()
 {
-    Node node;
-    node.name = gltf_node.name;
-    node.child_ids = gltf_node.children;
-    node.node_id = current_id;
-    node.parent_id = parent_id;
-    node.mesh_id = gltf_node.mesh;
-    node.skin_id = gltf_node.skin;
-
-    /* save matrix data */
-    if(gltf_node.matrix.size() == 16)
-    {
-        node.matrix = orca::MakeMatrix4X4<float>(gltf_node.matrix.data());
-    }
-
-    /* save translation data */
-    if(gltf_node.translation.size() == 3)
-    {
-        node.translate = orca::MakeVector3<float>(gltf_node.translation.data());
-    }
-
-    /* save rotation data */
-    if(gltf_node.rotation.size() == 4)
-    {
-        /* store quaternion information in vec4 type */
-        node.rotate = orca::MakeVector4<float>(gltf_node.rotation.data());
-    }
-
-    /* save sacle data */
-    if(gltf_node.scale.size() == 3)
-    {
-        node.scale = orca::MakeVector3<float>(gltf_node.scale.data());
-    }
-
-    /* save the loaded node to the node map */
-    nodes.insert(std::make_pair(current_id, node));
-
-    /* stores child nodes */
-    for(std::size_t i = 0; i < node.child_ids.size(); ++i)
-    {
-        LoadglTFNode(gltf_model, gltf_model.nodes[node.child_ids[i]], current_id, node.child_ids[i], nodes);
-    }
+    joint_palette.CleanupPalette();
 }
 
-/* a function that loads skin data */
-/* return the loaded skin          */
-Skin LoadglTFSkin(const tinygltf::Model& gltf_model, const tinygltf::Skin& gltf_skin)
+/* function to update the state of the model */
+/* (mainly update animation)                 */
+void Model::Update(double delta_time)
 {
-    Skin skin;
-    skin.name = gltf_skin.name;
-    skin.joints = gltf_skin.joints;
-    skin.skeleton_root_id = gltf_skin.skeleton;
-
-    /* store inverse bind matrices */
-    if(gltf_skin.inverseBindMatrices > -1)
-    {
-        const auto& accessor = gltf_model.accessors[gltf_skin.inverseBindMatrices];
-        const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-        const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-        const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
-        const auto byte_stride = accessor.ByteStride(buffer_view);
-        const auto count = accessor.count;
-
-        if(accessor.type == TINYGLTF_TYPE_MAT4)
-        {
-            if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-            {
-                skin.inverse_bind_matrices.reserve(count);
-                for(std::size_t i = 0; i < count; ++i)
-                {
-                    orca::mat4<float> mat = orca::MakeMatrix4X4<float, float>(reinterpret_cast<const float*>(data_address + i * byte_stride));
-                    skin.inverse_bind_matrices.emplace_back(mat);
-                }
-            }
-            else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-            {
-                skin.inverse_bind_matrices.reserve(count);
-                for(std::size_t i = 0; i < count; ++i)
-                {
-                    orca::mat4<float> mat = orca::MakeMatrix4X4<float, double>(reinterpret_cast<const double*>(data_address + i * byte_stride));
-                    skin.inverse_bind_matrices.emplace_back(mat);
-                }
-            }
-            else { throw std::runtime_error("Undefined inverse bind matrices component type."); }
-        }
-        else { throw std::runtime_error("Undefined inverse bind matrices type."); }
-    }
-
-    return skin;
+    PROFILE_ZONE("Model::Update", "animation");
+    scene.Update(delta_time);
 }
 
-/* a function that loads animation data */
-/* return the loaded animation          */
-Animation LoadglTFAnimation(const tinygltf::Model& gltf_model, const tinygltf::Animation& gltf_animation)
+/* function to copy what the render needs from the last Update() into 'snapshot' */
+void Model::WriteSnapshot(PoseSnapshot& snapshot) const
 {
-    Animation animation;
-    animation.name = gltf_animation.name;
-
-    /* save animation sampler information */
-    animation.samplers.reserve(gltf_animation.samplers.size());
-    for(const auto& sampler : gltf_animation.samplers)
-    {
-        AnimationSampler anim_sampler;
-
-        /* save the animation sampler interpolation information */
-        if(sampler.interpolation == "LINEAR")
-        {
-            anim_sampler.interpolation = INTERPOLATION_TYPE::LINEAR;
-        }
-        else if(sampler.interpolation == "STEP")
-        {
-            anim_sampler.interpolation = INTERPOLATION_TYPE::STEP;
-        }
-        else if(sampler.interpolation == "CUBICSPLINE")
-        {
-            anim_sampler.interpolation = INTERPOLATION_TYPE::CUBICSPLINE;
-        }
-        else 
-        { 
-            anim_sampler.interpolation = INTERPOLATION_TYPE::UNKNOWN;
-            std::cout << "Undefined animation sampler interpolation. "; 
-            std::cout << "(interpolation: " << sampler.interpolation << ")" << std::endl;
-        }
-
-        /* save animation sampler input information */
-        {
-            const auto& accessor = gltf_model.accessors[sampler.input];
-            const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-            const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-            const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
-            const auto byte_stride = accessor.ByteStride(buffer_view);
-            const auto count = accessor.count;
-
-            if(accessor.type == TINYGLTF_TYPE_SCALAR)
-            {
-                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                {
-                    anim_sampler.inputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        anim_sampler.inputs.emplace_back(*(reinterpret_cast<const float*>(data_address + i * byte_stride)));
-                    }
-                }
-                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                {
-                    anim_sampler.inputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        anim_sampler.inputs.emplace_back(*(reinterpret_cast<const double*>(data_address + i * byte_stride)));
-                    }
-                }
-                else { throw std::runtime_error("Warning::Undefined animation sampler inputs component type."); }
-            }
-            else { throw std::runtime_error("Undefined animation sampler inputs type."); }
-        }
-
-        /* save start time and end time of animation */
-        for(const auto& input : anim_sampler.inputs)
-        {
-            if(input < animation.start_time)
-            {
-                animation.start_time = input;
-            }
-
-            if(input > animation.end_time)
-            {
-                animation.end_time = input;
-            }
-        }
-
-        /* save the animation sampler outputs information */
-        {
-            const auto& accessor = gltf_model.accessors[sampler.output];
-            const auto& buffer_view = gltf_model.bufferViews[accessor.bufferView];
-            const auto& buffer = gltf_model.buffers[buffer_view.buffer];
-
-            const auto data_address = buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
-            const auto byte_stride = accessor.ByteStride(buffer_view);
-            const auto count = accessor.count;
-
-            /* FIXME: the animation sampler output type of some modeling files is not processed */
-            if(accessor.type == TINYGLTF_TYPE_VEC3)
-            {
-                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                {
-                    anim_sampler.outputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        float x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + i * byte_stride));
-                        float y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + i * byte_stride));
-                        float z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + i * byte_stride));
-                        float w = 0.0f;
-                        anim_sampler.outputs.emplace_back(x, y, z, w);
-                    }
-                }
-                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                {
-                    anim_sampler.outputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        double x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + i * byte_stride));
-                        double y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + i * byte_stride));
-                        double z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + i * byte_stride));
-                        double w = 0.0f;
-                        anim_sampler.outputs.emplace_back(x, y, z, w);
-                    }
-                }
-                else { throw std::runtime_error("Undefined animation sampler outputs component type."); }
-            }
-            else if(accessor.type == TINYGLTF_TYPE_VEC4)
-            {
-                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                {
-                    anim_sampler.outputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        float x = *(reinterpret_cast<const float*>(data_address + 0 * sizeof(float) + i * byte_stride));
-                        float y = *(reinterpret_cast<const float*>(data_address + 1 * sizeof(float) + i * byte_stride));
-                        float z = *(reinterpret_cast<const float*>(data_address + 2 * sizeof(float) + i * byte_stride));
-                        float w = *(reinterpret_cast<const float*>(data_address + 3 * sizeof(float) + i * byte_stride));
-                        anim_sampler.outputs.emplace_back(x, y, z, w);
-                    }
-                }
-                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                {
-                    anim_sampler.outputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        double x = *(reinterpret_cast<const double*>(data_address + 0 * sizeof(double) + i * byte_stride));
-                        double y = *(reinterpret_cast<const double*>(data_address + 1 * sizeof(double) + i * byte_stride));
-                        double z = *(reinterpret_cast<const double*>(data_address + 2 * sizeof(double) + i * byte_stride));
-                        double w = *(reinterpret_cast<const double*>(data_address + 3 * sizeof(double) + i * byte_stride));
-                        anim_sampler.outputs.emplace_back(x, y, z, w);
-                    }
-                }
-                else { throw std::runtime_error("Undefined animation sampler outputs component type."); }
-            }
-            else if(accessor.type == TINYGLTF_TYPE_SCALAR)
-            {
-                if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                {
-                    anim_sampler.outputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        double x = *(reinterpret_cast<const float*>(data_address + i * byte_stride));
-                        anim_sampler.outputs.emplace_back(x, 0, 0, 0);
-                    }
-                }
-                else if(accessor.componentType == TINYGLTF_COMPONENT_TYPE_DOUBLE)
-                {
-                    anim_sampler.outputs.reserve(count);
-                    for(std::size_t i = 0; i < count; ++i)
-                    {
-                        double x = *(reinterpret_cast<const double*>(data_address + i * byte_stride));
-                        anim_sampler.outputs.emplace_back(x, 0, 0, 0);
-                    }
-                }
-                else { throw std::runtime_error("Undefined animation sampler outputs component type."); }
-            }
-            else { throw std::runtime_error("Undefined animation sampler outputs type."); }
-        }
-
-        animation.samplers.emplace_back(anim_sampler);
-    } // for each sampler in glTF animation
-
-
-    /* save animation channel information */
-    animation.channels.reserve(gltf_animation.channels.size());
-    for(auto& channel : gltf_animation.channels)
-    {
-        AnimationChannel anim_channel;
-
-        /* save animation channel path type information */
-        if(channel.target_path == "rotation")
-        {
-            anim_channel.path_type = PATH_TYPE::ROTATION;
-        }
-        else if(channel.target_path == "translation")
-        {
-            anim_channel.path_type = PATH_TYPE::TRANSLATION;
-        }
-        else if(channel.target_path == "scale")
-        {
-            anim_channel.path_type = PATH_TYPE::SCALE;
-        }
-        else if(channel.target_path == "weights")
-        {
-            anim_channel.path_type = PATH_TYPE::WEIGHTS;
-        }
-        else 
-        {
-            anim_channel.path_type = PATH_TYPE::UNKNOWN;
-            std::cout << "Warning::Undefined animation channel path type. ";
-            std::cout << "(path type: " << channel.target_path << ")" << std::endl;
-        }
-
-        anim_channel.node_id = channel.target_node;
-        anim_channel.sampler_id = channel.sampler;
-
-        animation.channels.emplace_back(anim_channel);
-    } // for each channel in glTF animation
-
-    return animation;
+    scene.WriteSnapshot(snapshot);
 }
 
-/* a function that loads texture data */
-/* return the loaded texture          */
-Texture LoadglTFTexture(const tinygltf::Model& gltf_model, const tinygltf::Texture& gltf_texture)
+/* function to mark the meshes outside the camera frustum so Render() skips them */
+/* NOTE: skinned meshes are tested with the bounds of their joints in 'snapshot'. */
+/*       those are linear blend bounds, a dual quaternion skinned mesh can leave  */
+/*       them so it is never culled                                               */
+void Model::Cull(const Frustum& frustum, const PoseSnapshot& snapshot)
 {
-    Texture texture;
-    
-    /* save the glTF image */
-    {
-        const tinygltf::Image& gltf_image = gltf_model.images[gltf_texture.source];
-        texture.image.name = gltf_image.uri;
-        texture.image.width = gltf_image.width;
-        texture.image.height = gltf_image.height;
-        texture.image.component = gltf_image.component;
-        texture.image.data = gltf_image.image;
+    const bool skinned = (GetSkinningType() != SKINNING_TYPE::NONE);
+    const bool dual_quaternion = (GetSkinningType() == SKINNING_TYPE::DUAL_QUATERNION);
+
+    visible_meshes = 0;
+    culled_meshes = 0;
+    std::size_t index = 0;
+    for(auto& mesh : scene.GetMeshes())
+    {
+        const BoundingBox& bounds = snapshot.bounds[index++];
+        if(dual_quaternion == true && bounds.IsEmpty() == false)
+            mesh.second.visible = true;
+        else if(skinned == true && bounds.IsEmpty() == false)
+            mesh.second.visible = IsVisible(frustum, MakeBoundingSphere(bounds)) && IsVisible(frustum, bounds);
+        else
+            mesh.second.visible = IsVisible(frustum, mesh.second.local_sphere) && IsVisible(frustum, mesh.second.local_bounds);
+
+        if(mesh.second.visible == true)
+            visible_meshes += 1;
+        else
+            culled_meshes += 1;
     }
+}
 
-    /* save the glTF image sampler */
-    {
-        if(gltf_texture.sampler > -1)
-        {
-            const tinygltf::Sampler& gltf_sampler = gltf_model.samplers[gltf_texture.sampler];
-            texture.sampler.name = gltf_sampler.name;
-            texture.sampler.min_filter = GetFilterMode(gltf_sampler.minFilter);
-            texture.sampler.mag_filter = GetFilterMode(gltf_sampler.magFilter);
-            texture.sampler.wrap_R = GetWrapMode(gltf_sampler.wrapR);
-            texture.sampler.wrap_S = GetWrapMode(gltf_sampler.wrapS);
-            texture.sampler.wrap_T = GetWrapMode(gltf_sampler.wrapT);
-        }
-    }
+/* function to render model with the joints of 'snapshot' */
+void Model::Render(const Shader& shader, UploadRing& upload_ring, const PoseSnapshot& snapshot)
+{
+    PROFILE_ZONE("Model::Render", "render");
+    frame_arena.Reset();
+    PrepareRender(shader, upload_ring, snapshot);
+    rendered_indirect = false;
+
+    /* gather the draws, sort them by state and submit them with the redundant binds left out */
+    render_queue.Clear();
+    std::size_t index = 0;
+    for(const auto& mesh : scene.GetMeshes())
+    {
+        const int mesh_joint_offset = snapshot.joint_offsets[index++];
+        if(mesh.second.visible == false)
+            continue;
 
-    return texture;
+        DrawItem item;
+        item.program = shader.get();
+        item.material_id = mesh.second.material_id;
+        item.vertex_array = asset->GetVertexArray(mesh.first);
+        item.vertex_count = mesh.second.vertex_count;
+        item.joint_offset = (joint_offset_location > -1) ? joint_palette.BaseTexel() + mesh_joint_offset : -1;
+        item.texture = asset->GetBaseColorTexture(mesh.second.material_id);
+        render_queue.Push(item);
+    }
+    render_queue.Sort(frame_arena);
+    render_queue.Submit(joint_offset_location);
 }
 
-/* a function that loads material data */
-/* return the loaded material          */
-Material LoadglTFMaterial(const tinygltf::Model& gltf_model, const tinygltf::Material& gltf_material)
+/* function to render the visible meshes with one multi-draw call per texture     */
+/* NOTE: the commands and the per-draw parameters (location 10) are written into */
+/*       the upload ring. without multi-draw indirect the commands are drawn one */
+/*       by one from the same arrays.                                            */
+void Model::RenderIndirect(const Shader& shader, UploadRing& upload_ring, const PoseSnapshot& snapshot)
 {
-    Material material;
-
-    {
-        auto base_color_texture_id = gltf_material.values.find("baseColorTexture");
-        if(base_color_texture_id != gltf_material.values.end())
-        {
-            material.base_color_texture_id = base_color_texture_id->second.TextureIndex();
-            material.texture_coordinate_sets.base_color = static_cast<unsigned char>(base_color_texture_id->second.TextureTexCoord());
-        }
-    }
+    PROFILE_ZONE("Model::RenderIndirect", "render");
+    frame_arena.Reset();
+    PrepareRender(shader, upload_ring, snapshot);
+    rendered_indirect = true;
 
+    indirect_list.Clear();
+    std::size_t index = 0;
+    for(const auto& mesh : scene.GetMeshes())
     {
-        auto metallic_roughness_texture = gltf_material.values.find("metallicRoughnessTexture");
-        if(metallic_roughness_texture != gltf_material.values.end())
-        {
-            material.metallic_roughness_texture_id = metallic_roughness_texture->second.TextureIndex();
-            material.texture_coordinate_sets.metallic_roughness = static_cast<unsigned char>(metallic_roughness_texture->second.TextureTexCoord());
-        }
-    }
+        const int mesh_joint_offset = snapshot.joint_offsets[index++];
+        if(mesh.second.visible == false)
+            continue;
 
-    {
-        auto roughness_factor = gltf_material.values.find("roughnessFactor");
-        if(roughness_factor != gltf_material.values.end())
-        {
-            material.roughness_factor = static_cast<float>(roughness_factor->second.Factor());
-        }
+        const unsigned int texture = asset->GetBaseColorTexture(mesh.second.material_id);
+        const int joint_offset = (joint_palette_location > -1) ? joint_palette.BaseTexel() + mesh_joint_offset : 0;
+        indirect_list.Push(texture, mesh.second.first_vertex, mesh.second.vertex_count, joint_offset, mesh.second.material_id);
     }
+    indirect_list.Build(frame_arena);
 
-    {
-        auto metallic_factor = gltf_material.values.find("metallicFactor");
-        if(metallic_factor != gltf_material.values.end())
-        {
-            material.metallic_factor = static_cast<float>(metallic_factor->second.Factor());
-        }
-    }
+    indirect_stats.Reset();
+    if(indirect_list.Size() == 0)
+        return;
 
-    {
-        auto base_color_factor = gltf_material.values.find("baseColorFactor");
-        if(base_color_factor != gltf_material.values.end())
-        {
-            material.base_color_factor = orca::MakeVector4<float>(base_color_factor->second.ColorFactor().data());
-        }
-    }
+    const GeometryBuffer& geometry_buffer = asset->GetGeometryBuffer();
+    GLState& state = GLState::Get();
+    state.UseProgram(shader.get());
+    state.BindVertexArray(geometry_buffer.GetVertexArray());
+    indirect_stats.program_changes += 1;
+    indirect_stats.vertex_array_changes += 1;
 
+    const auto& commands = indirect_list.GetCommands();
+    const auto& parameters = indirect_list.GetParameters();
+    if(geometry_buffer.SupportsMultiDrawIndirect() == true)
     {
-        auto normal_texture = gltf_material.additionalValues.find("normalTexture");
-        if(normal_texture != gltf_material.additionalValues.end())
-        {
-            material.normal_texture_id = normal_texture->second.TextureIndex();
-            material.texture_coordinate_sets.normal = static_cast<unsigned char>(normal_texture->second.TextureTexCoord());
-        }
-    }
+        const std::size_t command_bytes = sizeof(DrawArraysIndirectCommand) * commands.size();
+        const std::size_t parameter_bytes = sizeof(DrawParameters) * parameters.size();
+        const UploadAllocation command_allocation = upload_ring.Allocate(command_bytes, sizeof(unsigned int));
+        const UploadAllocation parameter_allocation = upload_ring.Allocate(parameter_bytes, sizeof(int));
+        std::memcpy(command_allocation.data, commands.data(), command_bytes);
+        std::memcpy(parameter_allocation.data, parameters.data(), parameter_bytes);
+        upload_ring.Flush();
 
-    {
-        auto emissive_texture = gltf_material.additionalValues.find("emissiveTexture");
-        if(emissive_texture != gltf_material.additionalValues.end())
-        {
-            material.emissive_texture_id = emissive_texture->second.TextureIndex();
-            material.texture_coordinate_sets.emissive = static_cast<unsigned char>(emissive_texture->second.TextureTexCoord());
-        }
-    }
+        state.BindBuffer(GL_ARRAY_BUFFER, upload_ring.GetBuffer());
+        glVertexAttribIPointer(10, 2, GL_INT, sizeof(DrawParameters), reinterpret_cast<void*>(parameter_allocation.offset));
+        state.BindBuffer(GL_DRAW_INDIRECT_BUFFER, upload_ring.GetBuffer());
 
-    {
-        auto occlusion_texture = gltf_material.additionalValues.find("occlusionTexture");
-        if(occlusion_texture != gltf_material.additionalValues.end())
+        for(const auto& batch : indirect_list.GetBatches())
         {
-            material.occlusion_texture_id = occlusion_texture->second.TextureIndex();
-            material.texture_coordinate_sets.occlusion = static_cast<unsigned char>(occlusion_texture->second.TextureTexCoord());
+            if(batch.texture != 0)
+            {
+                state.BindTexture(GL_TEXTURE_2D, batch.texture);
+                indirect_stats.texture_changes += 1;
+            }
+            const std::size_t offset = command_allocation.offset + sizeof(DrawArraysIndirectCommand) * batch.first_command;
+            glMultiDrawArraysIndirect(GL_TRIANGLES, reinterpret_cast<void*>(offset), static_cast<GLsizei>(batch.command_count), 0);
+            indirect_stats.draw_calls += 1;
+            indirect_stats.instances += batch.command_count;
         }
     }
-
+    else
     {
-        auto alpha_mode = gltf_material.additionalValues.find("alphaMode");
-        if(alpha_mode != gltf_material.additionalValues.end())
+        for(const auto& batch : indirect_list.GetBatches())
         {
-            const tinygltf::Parameter& param = alpha_mode->second;
-            if(param.string_value == "BLEND")
+            if(batch.texture != 0)
             {
-                material.alpha_mode = ALPHA_MODE::ALPHA_MODE_BLEND;
+                state.BindTexture(GL_TEXTURE_2D, batch.texture);
+                indirect_stats.texture_changes += 1;
             }
-            else if(param.string_value == "MASK")
+            for(unsigned int i = batch.first_command; i < batch.first_command + batch.command_count; ++i)
             {
-                material.alpha_mode = ALPHA_MODE::ALPHA_MODE_MASK;
-                material.alpha_cutoff = 0.5f;
+                glVertexAttribI2i(10, parameters[i].joint_offset, parameters[i].material_id);
+                glDrawArrays(GL_TRIANGLES, static_cast<GLint>(commands[i].first), static_cast<GLsizei>(commands[i].count));
+                indirect_stats.uniform_changes += 1;
+                indirect_stats.draw_calls += 1;
+                indirect_stats.instances += 1;
             }
         }
     }
+}
 
-    {
-        auto alpha_cutoff = gltf_material.additionalValues.find("alphaCutoff");
-        if(alpha_cutoff != gltf_material.additionalValues.end())
-        {
-            material.alpha_cutoff = static_cast<float>(alpha_cutoff->second.Factor());
-        }
-    }
+/* function to sample every animation of the model into the palette of a crowd */
+/* NOTE: the frames hold linear skinning joints. the pose of the model is      */
+/*       restored afterwards.                                                  */
+void Model::BakeAnimations(Crowd& crowd, float frames_per_second)
+{
+    if(IsAnimated() == false)
+        throw std::runtime_error("crowd bake error: the model is not animated.");
 
-    {
-        auto emissive_factor = gltf_material.additionalValues.find("emissiveFactor");
-        if(emissive_factor != gltf_material.additionalValues.end())
-        {
-            material.emissive_factor = orca::vec4<float>(orca::MakeVector3<float>(emissive_factor->second.ColorFactor().data()), 1.0f);
-        }
-    }
+    const std::map<int, Node> live_nodes = scene.GetNodes();
 
-    // extensions
+    crowd.BeginBake(frames_per_second);
+    for(const auto& animation : scene.GetAnimations())
     {
-        auto extension = gltf_material.extensions.find("KHR_materials_pbrSpecularGlossiness");
-        if(extension != gltf_material.extensions.end())
-        {
-            if(extension->second.Has("specularGlossinessTexture"))
-            {
-                material.extension.specular_glossiness_texture_id = extension->second.Get("specularGlossinessTexture").Get("index").Get<int>();
-                material.texture_coordinate_sets.specular_glossiness = static_cast<unsigned char>(extension->second.Get("specularGlossinessTexture").Get("texCoord").Get<int>());
-                material.work_flow = PBR_WORK_FLOW::SPECULAR_GLOSSINESS;
-            }
+        const float duration = animation.second.end_time - animation.second.start_time;
+        const int frame_count = std::max(1, static_cast<int>(std::ceil(duration * frames_per_second)));
 
-            if(extension->second.Has("diffuseTexture"))
-            {
-                material.extension.diffuse_texture_id = extension->second.Get("diffuseTexture").Get("index").Get<int>();
-            }
-
-            if(extension->second.Has("diffuseFactor"))
-            {
-                auto factor = extension->second.Get("diffuseFactor");
-                for(std::size_t i = 0; i < factor.ArrayLen(); ++i)
-                {
-                    auto value = factor.Get(i);
-                    material.extension.diffuse_factor[i] = value.IsNumber() ? static_cast<float>(value.Get<double>()) : static_cast<float>(value.Get<int>());
-                }
-            }
-
-            if(extension->second.Has("specularFactor"))
-            {
-                auto factor = extension->second.Get("specularFactor");
-                for(std::size_t i = 0; i < factor.ArrayLen(); ++i)
-                {
-                    auto value = factor.Get(i);
-                    material.extension.specular_factor[i] = value.IsNumber() ? static_cast<float>(value.Get<double>()) : static_cast<float>(value.Get<int>());
-                }
-            }
+        crowd.BeginClip();
+        for(int i = 0; i < frame_count; ++i)
+        {
+            scene.SamplePose(animation.first, static_cast<float>(i) / frames_per_second);
+            crowd.AppendFrame(scene.GetMeshes());
         }
     }
 
-    return material;
+    scene.SetNodes(live_nodes);
 }
 
-
-/* constructor */
-Model::Model(const std::string& directory, const std::string& filename)
-    : curr_animation(0)
-    , directory(directory)
-    , filename(filename)
-    , meshes()
-    , nodes()
-    , skins()
-    , animations()
+/* function to render every instance of a crowd with one instanced draw per skinned mesh */
+/* NOTE: the program of 'shader' must be in use, like Render()                          */
+void Model::RenderCrowd(const Shader& shader, Crowd& crowd)
 {
-    LoadModel(directory + '/' + filename);
-    SetupModel();
-}
-
-/* copy constructor */
-Model::Model(const Model& other)
-    : curr_animation(other.curr_animation)
-    , directory(other.directory)
-    , filename(other.filename)
-    , meshes(other.meshes)
-    , nodes(other.nodes)
-    , skins(other.skins)
-    , animations(other.animations)
-    , textures(other.textures)
-{ /* empty */ }
+    PROFILE_ZONE("Model::RenderCrowd", "render");
+    frame_arena.Reset();
+    rendered_indirect = false;
+    if(crowd.Size() == 0)
+        return;
+
+    /* NOTE: the locations are looked up when the shader changes, a name longer than the */
+    /*       small string buffer would allocate its std::string key every frame          */
+    if(crowd_program != shader.get())
+    {
+        crowd_program = shader.get();
+        crowd_offset_location = shader.getUniformLocation("joint_offset");
+        crowd_palette_location = shader.getUniformLocation("joint_palette");
+        frame_stride_location = shader.getUniformLocation("frame_stride");
+        frames_per_second_location = shader.getUniformLocation("frames_per_second");
+        time_location = shader.getUniformLocation("time");
+    }
+
+    crowd.Upload();
+    GLState::Get().ActiveTexture(1);
+    crowd.BindPalette();
+    GLState::Get().ActiveTexture(0);
+    glUniform1i(crowd_palette_location, 1);
+    glUniform1i(frame_stride_location, crowd.GetFrameStride());
+    glUniform1f(frames_per_second_location, crowd.GetFramesPerSecond());
+    glUniform1f(time_location, crowd.GetTime());
+
+    /* the draw count depends on the meshes only, not on the number of instances */
+    render_queue.Clear();
+    for(const auto& mesh : scene.GetMeshes())
+    {
+        const int joint_offset = crowd.GetMeshOffset(mesh.first);
+        if(joint_offset < 0)
+            continue;
 
-/* destructor */
-Model::~Model()
-{
-    CleanupModel();
+        const unsigned int vertex_array = asset->GetVertexArray(mesh.first);
+        crowd.AttachInstances(vertex_array);
+
+        DrawItem item;
+        item.program = shader.get();
+        item.material_id = mesh.second.material_id;
+        item.vertex_array = vertex_array;
+        item.vertex_count = mesh.second.vertex_count;
+        item.instance_count = static_cast<unsigned int>(crowd.Size());
+        item.joint_offset = joint_offset;
+        item.texture = asset->GetBaseColorTexture(mesh.second.material_id);
+        render_queue.Push(item);
+    }
+    render_queue.Sort(frame_arena);
+    render_queue.Submit(crowd_offset_location);
 }
 
-/* function that does initial work so that the model can be used */
-void Model::SetupModel()
+/* function to stream up to 'budget' bytes of the texture levels of the asset still missing through 'upload_ring' */
+/* NOTE: the asset streams once per frame of the ring, the other models sharing it get 0                      */
+std::size_t Model::StreamTextures(UploadRing& upload_ring, std::size_t budget)
 {
-    for(std::size_t i = 0; i < textures.size(); ++i)
-        textures[i].SetupTexture();
-
-    for(std::size_t i = 0; i < meshes.size(); ++i)
-        meshes[i].SetupMesh();
+    return asset->StreamTextures(upload_ring, budget);
 }
 
-/* function to clean up the model used */
-void Model::CleanupModel()
+/* function to return the number of textures whose levels are not all streamed yet */
+std::size_t Model::GetStreamingTextures() const
 {
-    for(std::size_t i = 0; i < textures.size(); ++i)
-        textures[i].CleanupTexture();
-
-    for(std::size_t i = 0; i < meshes.size(); ++i)
-        meshes[i].CleanupMesh();
+    return asset->GetStreamingTextures();
 }
 
-/* function to update the state of the model */
-/* (mainly update animation)                 */
-void Model::Update(double delta_time)
+/* function to return the CPU and GPU bytes of the asset and of the animation state of the model */
+/* NOTE: models sharing the asset each count it. a joint palette streamed through an upload     */
+/*       ring is in the ring, not counted here                                                  */
+MemoryUsage Model::GetMemoryUsage() const
 {
-    static double total_time = 0.0f;
-    total_time += delta_time;
-
-    if(animations.size() > 0)
-    {
-        /* NOTE: only the first animation is used */
-        UpdateAnimation(total_time);
-    }
+    MemoryUsage usage = asset->GetMemoryUsage();
+    usage += scene.GetStateMemoryUsage();
+    usage.AddGpu(MEMORY_CATEGORY::PALETTES, joint_palette.AllocatedBytes());
+    return usage;
 }
 
-/* function to render model */
-void Model::Render(unsigned int shader_program)
+/* function to return the loaded data and GL objects drawn by the model */
+const ModelAsset& Model::GetAsset() const
 {
-    for(std::size_t i = 0; i < meshes.size(); ++i)
-    {  
-        if(meshes[i].material_id > -1)
-        {
-            const Material& material = materials[meshes[i].material_id];
-            
-            /* NOTE: use only diffuse texture */
-            if(material.base_color_texture_id > -1)
-            {
-                textures[material.base_color_texture_id].BindTexture();
-            }
-        }
-
-        meshes[i].Render(shader_program, IsAnimated());
-    }
+    return *asset;
 }
 
 bool Model::IsAnimated() const
 {
-    return (animations.size() > 0 && skins.size() > 0);
+    return scene.IsAnimated();
 }
 
 void Model::ChangeAnimation(int num)
 {
-    curr_animation = std::clamp<size_t>(curr_animation + num, 0, animations.size() - 1);
+    scene.ChangeAnimation(num);
 }
 
-/* load a file in glTF format */
-void Model::LoadModel(const std::string& file)
+/* function to return the skinning method used by the mesh shader */
+SKINNING_TYPE Model::GetSkinningType() const
 {
-    tinygltf::Model gltf_model;
-    LoadglTFModel(gltf_model, file);
-
-    /* load the mesh data */
-    for(std::size_t i = 0; i < gltf_model.meshes.size(); ++i)
-    {
-        meshes.insert(std::make_pair(i, LoadglTFMesh(gltf_model, gltf_model.meshes[i])));
-    }
-
-    /* load the node data                                */
-    /* NOTE: only store node data from the default scene */
-    const tinygltf::Scene& scene = gltf_model.scenes[gltf_model.defaultScene];
-    for(std::size_t i = 0; i < scene.nodes.size(); ++i)
-    {
-        LoadglTFNode(gltf_model, gltf_model.nodes[scene.nodes[i]], -1, scene.nodes[i], nodes);
-    }
-
-    /* save the matrix information of the mesh */
-    for(std::size_t i= 0; i < nodes.size(); ++i)
-    {
-        if(nodes[i].mesh_id > -1)
-        {
-            meshes[nodes[i].mesh_id].matrix = nodes[i].matrix;
-        }
-    }
-
-    /* load the texture data */
-    for(std::size_t i = 0; i < gltf_model.textures.size(); ++i)
-    {
-        textures.insert(std::make_pair(i, LoadglTFTexture(gltf_model, gltf_model.textures[i])));
-    }
-    
-    /* load the material data */
-    for(std::size_t i = 0; i < gltf_model.materials.size(); ++i)
-    {
-        materials.insert(std::make_pair(i, LoadglTFMaterial(gltf_model, gltf_model.materials[i])));
-    }
-    
-    /* load the animation data */
-    for(std::size_t i = 0; i < gltf_model.animations.size(); ++i)
-    {
-        animations.insert(std::make_pair(i, LoadglTFAnimation(gltf_model, gltf_model.animations[i])));
-    }
+    return scene.GetSkinningType();
+}
 
-    /* load the skin data */
-    for(std::size_t i = 0; i < gltf_model.skins.size(); ++i)
-    {
-        skins.insert(std::make_pair(i, LoadglTFSkin(gltf_model, gltf_model.skins[i])));
-    }
+/* function to select the skinning method of the model (see Scene) */
+void Model::SetSkinningType(SKINNING_TYPE type)
+{
+    scene.SetSkinningType(type);
 }
 
-/* function to return matrix information of node */
-orca::mat4<float> Model::GetNodeMatrix(int node_id)
+bool Model::IsRigidSkinning() const
 {
-    auto& node = nodes[node_id];
-    auto matrix = node.LocalMatrix();
+    return scene.IsRigidSkinning();
+}
 
-    for(auto id = node.parent_id; id != -1; id = nodes[id].parent_id)
-    {
-        matrix = matrix * nodes[id].LocalMatrix();
-    }
-    return matrix;
+/* function to return the draw calls and state changes of the last Render() or RenderIndirect() */
+const RenderStats& Model::GetRenderStats() const
+{
+    return (rendered_indirect == true) ? indirect_stats : render_queue.GetStats();
 }
 
-/* function to update the animation of the model */
-void Model::UpdateAnimation(double duration)
+/* function to return the number of meshes that passed the last Cull() */
+unsigned int Model::GetVisibleMeshes() const
 {
-    if (curr_animation >= animations.size())   
-        throw std::runtime_error("animation id error: out of range.");
+    return visible_meshes;
+}
 
-    bool updated = false;
-    Animation& animation = animations[curr_animation];
-    float time = std::fmod(static_cast<float>(duration), animation.end_time - animation.start_time);
+/* function to return the number of meshes dropped by the last Cull() */
+unsigned int Model::GetCulledMeshes() const
+{
+    return culled_meshes;
+}
 
-    for (auto& channel : animation.channels)
-    {
-        AnimationSampler& sampler = animation.samplers[channel.sampler_id];
-        if(sampler.inputs.size() > sampler.outputs.size())
-            continue;
+/* function to return the animation state of the model (the data is shared with the asset) */
+Scene& Model::GetScene()
+{
+    return scene;
+}
 
-        
-        for(std::size_t i = 0; i < sampler.inputs.size() - 1; ++i)
-        {
-            if((time >= sampler.inputs[i]) && (time <= sampler.inputs[i + 1]))
-            {
-                float u = std::max(0.0f, time - sampler.inputs[i]) / (sampler.inputs[i + 1] - sampler.inputs[i]);
-                if(u <= 1.0f)
-                {
-                    /* NOTE: use the previous sampler output information of the current frame              */
-                    /* TODO: interpolate the sampler output information before and after the current frame */
-                    /*       using the interpolation information stored in the sampler                     */
-                    if(channel.path_type == PATH_TYPE::TRANSLATION)
-                    {
-                        auto translation = sampler.outputs[i];
-                        // auto translation = orca::Lerp(sampler.outputs[i], sampler.outputs[i + 1], u);
-                        nodes[channel.node_id].translate = orca::vec3<float>(translation);
-                    }
-                    else if(channel.path_type == PATH_TYPE::SCALE)
-                    {
-                        auto scale = sampler.outputs[i];
-                        // auto scale = orca::Lerp(sampler.outputs[i], sampler.outputs[i + 1], u);
-                        nodes[channel.node_id].scale = orca::vec3<float>(scale);
-                    }
-                    else if(channel.path_type == PATH_TYPE::ROTATION)
-                    {
-                        auto rotation = sampler.outputs[i];
-                        // auto rotation = orca::Slerp(sampler.outputs[i], sampler.outputs[i + 1], u);
-                        nodes[channel.node_id].rotate = orca::Normalize(rotation);
-                    }
+const Scene& Model::GetScene() const
+{
+    return scene;
+}
 
-                    updated = true;
-                }
-            }
-        }
-    }
-    
-    if(updated == true)
-    {
-        UpdateNode(0);
-    }
+/* function to return the joint palette bytes uploaded by the last Render() */
+std::size_t Model::GetUploadedBytes() const
+{
+    return joint_palette.UploadedBytes();
 }
 
-/* function to update the transformation information of a node */
-void Model::UpdateNode(int node_id)
+/* function to write the joint palette of 'snapshot' and bind it for 'shader' */
+void Model::PrepareRender(const Shader& shader, UploadRing& upload_ring, const PoseSnapshot& snapshot)
 {
-    
-    auto& node = nodes[node_id];
-    if(node.mesh_id > -1)
+    /* NOTE: the locations are taken from the reflection of the shader when it changes */
+    if(render_program != shader.get())
     {
-        auto& mesh = meshes[node.mesh_id];
-        mesh.matrix = GetNodeMatrix(node_id);
-        if(node.skin_id > -1)
-        {
-            auto& skin = skins[node.skin_id];
-            auto inverse_transform = orca::Inverse(mesh.matrix);
-            unsigned int num_joints = std::min(static_cast<unsigned int>(skin.joints.size()), MAX_NUM_JOINTS);
-            for(unsigned int i = 0; i < num_joints; ++i)
-            {
-                /* NOTE: Reference: https://github.com/KhronosGroup/glTF-Tutorials/blob/master/gltfTutorial/gltfTutorial_020_Skins.md */
-                auto joint_mat = skin.inverse_bind_matrices[i] * GetNodeMatrix(skin.joints[i]) * inverse_transform;
-                mesh.joint_matrices[i] = joint_mat;
-            }
-        }
+        render_program = shader.get();
+        joint_palette_location = shader.getUniformLocation("joint_palette");
+        joint_offset_location = shader.getUniformLocation("joint_offset");
     }
 
-    for(auto child : node.child_ids)
+    /* the joints of every skinned mesh are written once into the upload ring and read from texture unit 1 */
+    if(joint_palette_location > -1)
     {
-        UpdateNode(child);
+        joint_palette.Upload(upload_ring, snapshot.texels);
+        upload_ring.Flush();
+        GLState::Get().ActiveTexture(1);
+        joint_palette.BindPalette();
+        GLState::Get().ActiveTexture(0);
+        glUniform1i(joint_palette_location, 1);
     }
 }
\ No newline at end of file
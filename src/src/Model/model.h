@@ -13,50 +13,96 @@
 #include <sstream>
 #include <string>
 #include <vector>
+#include <memory>
 #include <map>
 
-#include "mesh.h"
-#include "node.h"
-#include "skin.h"
-#include "animation.h"
-#include "texture.h"
-#include "material.h"
+#include "scene.h"
+#include "model_asset.h"
+#include "joint_palette.h"
+#include "pose_snapshot.h"
+#include "render_queue.h"
+#include "indirect_draw.h"
+#include "crowd.h"
+#include "Shader/shader.h"
+#include "Renderer/upload_ring.h"
 
 /***********************/
 /*  CLASS NAME: Model  */
 /***********************/
+/* the GL side of a glTF model: it draws a ModelAsset, the data and GL      */
+/* objects loaded once and shared by every model of the same file, with an */
+/* animation state of its own (an instance of the Scene of the asset).     */
+/* Update() and WriteSnapshot() touch only the animation state, Cull() and   */
+/* the Render functions only the GL state and a PoseSnapshot, so the update  */
+/* can run on another thread than the render while they trade snapshots.    */
+/* it is not copyable, a copy would share (and free twice) the GL objects.   */
 class Model
 {
 public:
     Model(const std::string& directory, const std::string& filename);
-    Model(const Model& other);
+    explicit Model(std::shared_ptr<ModelAsset> asset);
+    Model(const Model& other) = delete;
     ~Model();
 
+public:
+    Model& operator=(const Model& rhs) = delete;
+
 public:
     void SetupModel();
     void CleanupModel();
     void Update(double delta_time);
-    void Render(unsigned int shader_program);
+    void WriteSnapshot(PoseSnapshot& snapshot) const;
+    void Cull(const Frustum& frustum, const PoseSnapshot& snapshot);
+    void Render(const Shader& shader, UploadRing& upload_ring, const PoseSnapshot& snapshot);
+    void RenderIndirect(const Shader& shader, UploadRing& upload_ring, const PoseSnapshot& snapshot);
+    void BakeAnimations(Crowd& crowd, float frames_per_second);
+    void RenderCrowd(const Shader& shader, Crowd& crowd);
+    std::size_t StreamTextures(UploadRing& upload_ring, std::size_t budget);
 
 public:
     bool IsAnimated() const;
     void ChangeAnimation(int num);
+    SKINNING_TYPE GetSkinningType() const;
+    void SetSkinningType(SKINNING_TYPE type);
+    bool IsRigidSkinning() const;
+    std::size_t GetUploadedBytes() const;
+    const RenderStats& GetRenderStats() const;
+    unsigned int GetVisibleMeshes() const;
+    unsigned int GetCulledMeshes() const;
+    std::size_t GetStreamingTextures() const;
+    MemoryUsage GetMemoryUsage() const;
+    const ModelAsset& GetAsset() const;
+    Scene& GetScene();
+    const Scene& GetScene() const;
 
 private:
-    void LoadModel(const std::string& file);
-    orca::mat4<float> GetNodeMatrix(int node_id);
-    void UpdateAnimation(double duration);
-    void UpdateNode(int node_id);
+    void PrepareRender(const Shader& shader, UploadRing& upload_ring, const PoseSnapshot& snapshot);
 
 private:
-    size_t curr_animation;
-    std::string directory;
-    std::string filename;
-    std::map<int, Mesh> meshes;
-    std::map<int, Node> nodes;
-    std::map<int, Skin> skins;
-    std::map<int, Animation> animations;
-    std::map<int, Texture> textures;
-    std::map<int, Material> materials;
+    std::shared_ptr<ModelAsset> asset;
+    Scene scene;                    /* the animation state, sharing the data of the asset */
+    JointPalette joint_palette;     /* streams the texels of a PoseSnapshot, packs nothing */
+
+    /* uniform locations of the last shader passed to Render() */
+    unsigned int render_program;
+    int joint_palette_location;
+    int joint_offset_location;
+
+    /* uniform locations of the last shader passed to RenderCrowd() */
+    unsigned int crowd_program;
+    int crowd_offset_location;
+    int crowd_palette_location;
+    int frame_stride_location;
+    int frames_per_second_location;
+    int time_location;
+    RenderQueue render_queue;
+    FrameArena frame_arena;     /* scratch of a Render function, reset at its start */
+    IndirectDrawList indirect_list;
+    RenderStats indirect_stats;
+    bool rendered_indirect;     /* GetRenderStats() reports the indirect path */
+
+    /* meshes kept and dropped by the last Cull() */
+    unsigned int visible_meshes;
+    unsigned int culled_meshes;
 }; // class Model
 #endif // !_MODEL_H_
\ No newline at end of file
@@ -0,0 +1,149 @@
+/********************************/
+/*  FILE NAME: model_asset.cpp  */
+/********************************/
+#include "model_asset.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include "Profiler/profiler.h"
+
+/* constructor                                                                  */
+/* NOTE: the GL objects are made here, a GL context must be current (as it must */
+/*       be where the last handle of the asset is dropped)                      */
+ModelAsset::ModelAsset(const std::string& file, const AssetLoadOptions& options)
+    : file(file)
+    , options(options)
+    , scene()
+    , texture_streamer()
+    , geometry_buffer()
+    , streamed_ring(nullptr)
+    , streamed_frame(0)
+{
+    PROFILE_ZONE("ModelAsset::Load", "load");
+    scene.LoadScene(file);
+
+    /* NOTE: the scene is set up through its non-const accessors here only */
+    auto& meshes = scene.GetMeshes();
+    auto& textures = scene.GetTextures();
+
+    /* only the storage is made here, the levels are built on worker threads and streamed per frame */
+    for(auto& texture : textures)
+        texture.second.SetupTexture();
+    texture_streamer.Start(textures);
+
+    geometry_buffer.SetupBuffer(meshes);
+    for(auto& mesh : meshes)
+        mesh.second.SetupMesh(geometry_buffer.GetBuffer());
+
+    if(options.release_cpu_data == true)
+        ReleaseCpuData();
+}
+
+/* destructor */
+ModelAsset::~ModelAsset()
+{
+    texture_streamer.Stop();
+    for(auto& texture : scene.GetTextures())
+        texture.second.CleanupTexture();
+
+    for(auto& mesh : scene.GetMeshes())
+        mesh.second.CleanupMesh();
+    geometry_buffer.CleanupBuffer();
+}
+
+/* function to return the asset of 'file' loaded with 'options', shared with every */
+/* other user of the same file and options (see AssetCache)                       */
+std::shared_ptr<ModelAsset> ModelAsset::Load(const std::string& file, const AssetLoadOptions& options)
+{
+    return AssetCache<ModelAsset>::Get().Load(file, options, [](const std::string& canonical_file, const AssetLoadOptions& load_options)
+    {
+        return std::make_shared<ModelAsset>(canonical_file, load_options);
+    });
+}
+
+/* function to stream up to 'budget' bytes of the texture levels still missing through 'upload_ring' */
+/* NOTE: the models sharing the asset all call it every frame, only the first call of a frame of   */
+/*       the ring streams, the others return 0 so the frame uploads 'budget' bytes at most         */
+std::size_t ModelAsset::StreamTextures(UploadRing& upload_ring, std::size_t budget)
+{
+    if(streamed_ring == &upload_ring && streamed_frame == upload_ring.FrameNumber())
+        return 0;
+    streamed_ring = &upload_ring;
+    streamed_frame = upload_ring.FrameNumber();
+
+    PROFILE_ZONE("ModelAsset::StreamTextures", "render");
+    return texture_streamer.Stream(upload_ring, budget);
+}
+
+/* function to return the canonical path of the loaded file */
+const std::string& ModelAsset::GetFile() const
+{
+    return file;
+}
+
+const AssetLoadOptions& ModelAsset::GetOptions() const
+{
+    return options;
+}
+
+/* function to return the loaded data (in the bind pose, see Scene::Instantiate()) */
+const Scene& ModelAsset::GetScene() const
+{
+    return scene;
+}
+
+/* function to return the vertex buffer of every mesh (read by the multi-draw path) */
+const GeometryBuffer& ModelAsset::GetGeometryBuffer() const
+{
+    return geometry_buffer;
+}
+
+/* function to return the vertex array object of a mesh */
+unsigned int ModelAsset::GetVertexArray(int mesh_id) const
+{
+    return scene.GetMeshes().at(mesh_id).GetVertexArray();
+}
+
+/* function to return the texture object of the base color of a material, 0 if it has none */
+/* NOTE: only the diffuse texture is drawn                                                 */
+unsigned int ModelAsset::GetBaseColorTexture(int material_id) const
+{
+    if(material_id < 0)
+        return 0;
+
+    const Material& material = scene.GetMaterials().at(material_id);
+    const auto texture = scene.GetTextures().find(material.base_color_texture_id);
+    return (texture != scene.GetTextures().end()) ? texture->second.GetTexture() : 0;
+}
+
+/* function to return the number of textures whose levels are not all streamed yet */
+std::size_t ModelAsset::GetStreamingTextures() const
+{
+    return texture_streamer.NumRemaining();
+}
+
+/* function to return the CPU bytes of the loaded data and the GPU bytes of its buffers and textures */
+MemoryUsage ModelAsset::GetMemoryUsage() const
+{
+    MemoryUsage usage = scene.GetMemoryUsage();
+    usage.AddCpu(MEMORY_CATEGORY::TEXTURES, texture_streamer.ChainBytes());
+
+    usage.AddGpu(MEMORY_CATEGORY::VERTICES, sizeof(Vertex) * geometry_buffer.NumVertices());
+    for(const auto& texture : scene.GetTextures())
+        usage.AddGpu(MEMORY_CATEGORY::TEXTURES, texture.second.GpuBytes());
+    return usage;
+}
+
+/* function to free the CPU copies of the vertices and indices once uploaded              */
+/* NOTE: the draws read the GL buffers and the culling the bounds, nothing reads them      */
+/*       again. the images are freed by the texture streamer once their levels are uploaded */
+void ModelAsset::ReleaseCpuData()
+{
+    for(auto& mesh : scene.GetMeshes())
+    {
+        std::vector<Vertex>().swap(mesh.second.vertices);
+        std::vector<unsigned int>().swap(mesh.second.indices);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+/******************************/
+/*  FILE NAME: model_asset.h  */
+/******************************/
+#ifndef _MODEL_ASSET_H_
+#define _MODEL_ASSET_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "scene.h"
+#include "asset_cache.h"
+#include "geometry_buffer.h"
+#include "texture_streamer.h"
+#include "memory_usage.h"
+#include "Renderer/upload_ring.h"
+
+/****************************/
+/*  CLASS NAME: ModelAsset  */
+/****************************/
+/* a glTF file loaded once for every Model drawing it: the scene as loaded  */
+/* (the bind pose, never animated) and its GL objects, the vertex buffer,   */
+/* the vertex arrays, index buffers and textures, which it owns and frees.  */
+/* after the load only the texture levels still change as they stream in,  */
+/* once per frame however many models draw the asset.                      */
+/* Load() shares the assets through the AssetCache of the process.         */
+class ModelAsset
+{
+public:
+    ModelAsset(const std::string& file, const AssetLoadOptions& options);
+    ModelAsset(const ModelAsset& other) = delete;
+    ~ModelAsset();
+
+public:
+    ModelAsset& operator=(const ModelAsset& rhs) = delete;
+
+public:
+    static std::shared_ptr<ModelAsset> Load(const std::string& file, const AssetLoadOptions& options);
+
+public:
+    std::size_t StreamTextures(UploadRing& upload_ring, std::size_t budget);
+
+public:
+    const std::string& GetFile() const;
+    const AssetLoadOptions& GetOptions() const;
+    const Scene& GetScene() const;
+    const GeometryBuffer& GetGeometryBuffer() const;
+    unsigned int GetVertexArray(int mesh_id) const;
+    unsigned int GetBaseColorTexture(int material_id) const;
+    std::size_t GetStreamingTextures() const;
+    MemoryUsage GetMemoryUsage() const;
+
+private:
+    void ReleaseCpuData();
+
+private:
+    std::string file;
+    AssetLoadOptions options;
+    Scene scene;
+    TextureStreamer texture_streamer;
+    GeometryBuffer geometry_buffer;
+    const UploadRing* streamed_ring;    /* ring and frame of the last StreamTextures() */
+    std::uint64_t streamed_frame;
+}; // class ModelAsset
+#endif // !_MODEL_ASSET_H_
\ No newline at end of file
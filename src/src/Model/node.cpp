@@ -6,8 +6,10 @@
 /**************/
 /*  INCLUDES  */
 /**************/
+#include <utility>
 #include <vector_functions.hpp>
 #include <matrix_functions.hpp>
+#include <affine_functions.hpp>
 #include <quaternion_functions.hpp>
 
 /* default constructor */
@@ -22,13 +24,14 @@ Node::Node()
     , parent_id()
     , mesh_id()
     , skin_id()
+    , pose_id()
 {
-    matrix = orca::Identity(matrix);
     scale = orca::vec3<float>(1.0f);
     node_id = -1;
     parent_id = -1;
     mesh_id = -1;
     skin_id = -1;
+    pose_id = -1;
 }
 
 /* copy constructor */
@@ -43,10 +46,26 @@ Node::Node(const Node& other)
     , parent_id(other.parent_id)
     , mesh_id(other.mesh_id)
     , skin_id(other.skin_id)
+    , pose_id(other.pose_id)
+{ /* empty */ }
+
+/* move constructor */
+Node::Node(Node&& other) noexcept
+    : name(std::move(other.name))
+    , child_ids(std::move(other.child_ids))
+    , matrix(other.matrix)
+    , translate(other.translate)
+    , rotate(other.rotate)
+    , scale(other.scale)
+    , node_id(other.node_id)
+    , parent_id(other.parent_id)
+    , mesh_id(other.mesh_id)
+    , skin_id(other.skin_id)
+    , pose_id(other.pose_id)
 { /* empty */ }
 
 /* function to return local translation of node */
-orca::mat4<float> Node::LocalMatrix() const
+orca::affine<float> Node::LocalMatrix() const
 {
-    return matrix * orca::Scale(scale) * orca::QuaternionToMatrix(orca::quaternion(rotate)) * orca::Translate(translate);
+    return matrix * orca::MakeAffine(scale, orca::quaternion(rotate), translate);
 }
\ No newline at end of file
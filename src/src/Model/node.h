@@ -20,15 +20,20 @@ class Node
 public:
     Node();
     Node(const Node& other);
+    Node(Node&& other) noexcept;
 
 public:
-    orca::mat4<float> LocalMatrix() const;
+    Node& operator=(const Node& rhs) = default;
+    Node& operator=(Node&& rhs) noexcept = default;
+
+public:
+    orca::affine<float> LocalMatrix() const;
 
 public:
     std::string name;
     std::vector<int> child_ids;
 
-    orca::mat4<float> matrix;
+    orca::affine<float> matrix;
     orca::vec3<float> translate;
     orca::vec4<float> rotate;
     orca::vec3<float> scale;
@@ -37,5 +42,6 @@ public:
     int parent_id;
     int mesh_id;
     int skin_id;
+    int pose_id;
 }; // class Node
 #endif // !_NODE_H_
\ No newline at end of file
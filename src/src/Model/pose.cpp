@@ -0,0 +1,234 @@
+/*************************/
+/*  FILE NAME: pose.cpp  */
+/*************************/
+#include "pose.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <simd.hpp>
+#include <affine_functions.hpp>
+#include <quaternion.hpp>
+
+/* default constructor */
+Pose::Pose()
+    : parents()
+    , translate_x()
+    , translate_y()
+    , translate_z()
+    , rotate_x()
+    , rotate_y()
+    , rotate_z()
+    , rotate_w()
+    , scale_x()
+    , scale_y()
+    , scale_z()
+{ /* empty */ }
+
+/* copy constructor */
+Pose::Pose(const Pose& other)
+    : parents(other.parents)
+    , translate_x(other.translate_x)
+    , translate_y(other.translate_y)
+    , translate_z(other.translate_z)
+    , rotate_x(other.rotate_x)
+    , rotate_y(other.rotate_y)
+    , rotate_z(other.rotate_z)
+    , rotate_w(other.rotate_w)
+    , scale_x(other.scale_x)
+    , scale_y(other.scale_y)
+    , scale_z(other.scale_z)
+{ /* empty */ }
+
+/* function to change the number of joints (new joints are identity roots) */
+void Pose::Resize(std::size_t count)
+{
+    parents.resize(count, -1);
+    translate_x.resize(count, 0.0f);
+    translate_y.resize(count, 0.0f);
+    translate_z.resize(count, 0.0f);
+    rotate_x.resize(count, 0.0f);
+    rotate_y.resize(count, 0.0f);
+    rotate_z.resize(count, 0.0f);
+    rotate_w.resize(count, 1.0f);
+    scale_x.resize(count, 1.0f);
+    scale_y.resize(count, 1.0f);
+    scale_z.resize(count, 1.0f);
+}
+
+/* function to return the number of joints */
+std::size_t Pose::Size() const
+{
+    return parents.size();
+}
+
+/* function to store the local transform of a joint */
+/* (rotate is a quaternion stored as (x, y, z, w))  */
+void Pose::SetJoint(std::size_t index, const orca::vec3<float>& translate, const orca::vec4<float>& rotate, const orca::vec3<float>& scale)
+{
+    translate_x[index] = translate.x;
+    translate_y[index] = translate.y;
+    translate_z[index] = translate.z;
+    rotate_x[index] = rotate.x;
+    rotate_y[index] = rotate.y;
+    rotate_z[index] = rotate.z;
+    rotate_w[index] = rotate.w;
+    scale_x[index] = scale.x;
+    scale_y[index] = scale.y;
+    scale_z[index] = scale.z;
+}
+
+/* function to compute the local matrix of every joint                    */
+/* (same result as MakeAffine(scale, rotate, translate) for each joint).   */
+/* the SIMD paths build 4 (SSE2) or 8 (AVX2) joints per iteration straight */
+/* into the 3x4 rows, without intermediate matrices.                      */
+void PoseToLocalMatrices(const Pose& pose, orca::affine<float>* locals)
+{
+    const std::size_t count = pose.Size();
+    std::size_t i = 0;
+
+#if defined(ORCA_SIMD_AVX2)
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 two = _mm256_set1_ps(2.0f);
+        for(; i + 8 <= count; i += 8)
+        {
+            const __m256 qx = _mm256_loadu_ps(&pose.rotate_x[i]);
+            const __m256 qy = _mm256_loadu_ps(&pose.rotate_y[i]);
+            const __m256 qz = _mm256_loadu_ps(&pose.rotate_z[i]);
+            const __m256 qw = _mm256_loadu_ps(&pose.rotate_w[i]);
+            const __m256 sx = _mm256_loadu_ps(&pose.scale_x[i]);
+            const __m256 sy = _mm256_loadu_ps(&pose.scale_y[i]);
+            const __m256 sz = _mm256_loadu_ps(&pose.scale_z[i]);
+
+            const __m256 xx = _mm256_mul_ps(qx, qx);
+            const __m256 yy = _mm256_mul_ps(qy, qy);
+            const __m256 zz = _mm256_mul_ps(qz, qz);
+            const __m256 xy = _mm256_mul_ps(qx, qy);
+            const __m256 xz = _mm256_mul_ps(qx, qz);
+            const __m256 xw = _mm256_mul_ps(qx, qw);
+            const __m256 yz = _mm256_mul_ps(qy, qz);
+            const __m256 yw = _mm256_mul_ps(qy, qw);
+            const __m256 zw = _mm256_mul_ps(qz, qw);
+
+            __m256 rows[3][4];
+            rows[0][0] = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), sx);
+            rows[0][1] = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, zw)), sy);
+            rows[0][2] = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, yw)), sz);
+            rows[0][3] = _mm256_loadu_ps(&pose.translate_x[i]);
+
+            rows[1][0] = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, zw)), sx);
+            rows[1][1] = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), sy);
+            rows[1][2] = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, xw)), sz);
+            rows[1][3] = _mm256_loadu_ps(&pose.translate_y[i]);
+
+            rows[2][0] = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, yw)), sx);
+            rows[2][1] = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, xw)), sy);
+            rows[2][2] = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), sz);
+            rows[2][3] = _mm256_loadu_ps(&pose.translate_z[i]);
+
+            /* transpose from one element of 8 joints to one row of a joint */
+            for(unsigned int r = 0; r < 3; ++r)
+            {
+                const __m256 t0 = _mm256_unpacklo_ps(rows[r][0], rows[r][1]);
+                const __m256 t1 = _mm256_unpackhi_ps(rows[r][0], rows[r][1]);
+                const __m256 t2 = _mm256_unpacklo_ps(rows[r][2], rows[r][3]);
+                const __m256 t3 = _mm256_unpackhi_ps(rows[r][2], rows[r][3]);
+                const __m256 j0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 j1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 j2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 j3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+                _mm_store_ps(locals[i + 0].data[r].data, _mm256_castps256_ps128(j0));
+                _mm_store_ps(locals[i + 1].data[r].data, _mm256_castps256_ps128(j1));
+                _mm_store_ps(locals[i + 2].data[r].data, _mm256_castps256_ps128(j2));
+                _mm_store_ps(locals[i + 3].data[r].data, _mm256_castps256_ps128(j3));
+                _mm_store_ps(locals[i + 4].data[r].data, _mm256_extractf128_ps(j0, 1));
+                _mm_store_ps(locals[i + 5].data[r].data, _mm256_extractf128_ps(j1, 1));
+                _mm_store_ps(locals[i + 6].data[r].data, _mm256_extractf128_ps(j2, 1));
+                _mm_store_ps(locals[i + 7].data[r].data, _mm256_extractf128_ps(j3, 1));
+            }
+        }
+    }
+#endif
+
+#if defined(ORCA_SIMD_SSE2)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        for(; i + 4 <= count; i += 4)
+        {
+            const __m128 qx = _mm_loadu_ps(&pose.rotate_x[i]);
+            const __m128 qy = _mm_loadu_ps(&pose.rotate_y[i]);
+            const __m128 qz = _mm_loadu_ps(&pose.rotate_z[i]);
+            const __m128 qw = _mm_loadu_ps(&pose.rotate_w[i]);
+            const __m128 sx = _mm_loadu_ps(&pose.scale_x[i]);
+            const __m128 sy = _mm_loadu_ps(&pose.scale_y[i]);
+            const __m128 sz = _mm_loadu_ps(&pose.scale_z[i]);
+
+            const __m128 xx = _mm_mul_ps(qx, qx);
+            const __m128 yy = _mm_mul_ps(qy, qy);
+            const __m128 zz = _mm_mul_ps(qz, qz);
+            const __m128 xy = _mm_mul_ps(qx, qy);
+            const __m128 xz = _mm_mul_ps(qx, qz);
+            const __m128 xw = _mm_mul_ps(qx, qw);
+            const __m128 yz = _mm_mul_ps(qy, qz);
+            const __m128 yw = _mm_mul_ps(qy, qw);
+            const __m128 zw = _mm_mul_ps(qz, qw);
+
+            __m128 rows[3][4];
+            rows[0][0] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+            rows[0][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, zw)), sy);
+            rows[0][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, yw)), sz);
+            rows[0][3] = _mm_loadu_ps(&pose.translate_x[i]);
+
+            rows[1][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, zw)), sx);
+            rows[1][1] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+            rows[1][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, xw)), sz);
+            rows[1][3] = _mm_loadu_ps(&pose.translate_y[i]);
+
+            rows[2][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, yw)), sx);
+            rows[2][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, xw)), sy);
+            rows[2][2] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+            rows[2][3] = _mm_loadu_ps(&pose.translate_z[i]);
+
+            /* transpose from one element of 4 joints to one row of a joint */
+            for(unsigned int r = 0; r < 3; ++r)
+            {
+                _MM_TRANSPOSE4_PS(rows[r][0], rows[r][1], rows[r][2], rows[r][3]);
+                _mm_store_ps(locals[i + 0].data[r].data, rows[r][0]);
+                _mm_store_ps(locals[i + 1].data[r].data, rows[r][1]);
+                _mm_store_ps(locals[i + 2].data[r].data, rows[r][2]);
+                _mm_store_ps(locals[i + 3].data[r].data, rows[r][3]);
+            }
+        }
+    }
+#endif
+
+    /* remaining joints (all joints in the scalar build) */
+    for(; i < count; ++i)
+    {
+        const orca::vec3<float> translate(pose.translate_x[i], pose.translate_y[i], pose.translate_z[i]);
+        const orca::quaternion<float> rotate(pose.rotate_w[i], pose.rotate_x[i], pose.rotate_y[i], pose.rotate_z[i]);
+        const orca::vec3<float> scale(pose.scale_x[i], pose.scale_y[i], pose.scale_z[i]);
+        locals[i] = orca::MakeAffine(scale, rotate, translate);
+    }
+}
+
+/* function to concatenate local matrices down the hierarchy */
+/* ('locals' and 'worlds' may be the same array)              */
+void LocalToWorldMatrices(const Pose& pose, const orca::affine<float>* locals, orca::affine<float>* worlds)
+{
+    const std::size_t count = pose.Size();
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        const int parent = pose.parents[i];
+        worlds[i] = (parent < 0) ? locals[i] : locals[i] * worlds[parent];
+    }
+}
+
+/* function to compute the world matrix of every joint */
+void PoseToWorldMatrices(const Pose& pose, orca::affine<float>* worlds)
+{
+    PoseToLocalMatrices(pose, worlds);
+    LocalToWorldMatrices(pose, worlds, worlds);
+}
\ No newline at end of file
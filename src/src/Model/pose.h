@@ -0,0 +1,50 @@
+/***********************/
+/*  FILE NAME: pose.h  */
+/***********************/
+#ifndef _POSE_H_
+#define _POSE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <vector.hpp>
+#include <matrix.hpp>
+
+/**********************/
+/*  CLASS NAME: Pose  */
+/**********************/
+/* local transforms of a joint hierarchy in structure-of-arrays layout */
+/* NOTE: a parent always comes before its children                      */
+class Pose
+{
+public:
+    Pose();
+    Pose(const Pose& other);
+
+public:
+    Pose& operator=(const Pose& rhs) = default;
+
+public:
+    void Resize(std::size_t count);
+    std::size_t Size() const;
+    void SetJoint(std::size_t index, const orca::vec3<float>& translate, const orca::vec4<float>& rotate, const orca::vec3<float>& scale);
+
+public:
+    std::vector<int> parents;
+    std::vector<float> translate_x;
+    std::vector<float> translate_y;
+    std::vector<float> translate_z;
+    std::vector<float> rotate_x;
+    std::vector<float> rotate_y;
+    std::vector<float> rotate_z;
+    std::vector<float> rotate_w;
+    std::vector<float> scale_x;
+    std::vector<float> scale_y;
+    std::vector<float> scale_z;
+}; // class Pose
+
+void PoseToLocalMatrices(const Pose& pose, orca::affine<float>* locals);
+void LocalToWorldMatrices(const Pose& pose, const orca::affine<float>* locals, orca::affine<float>* worlds);
+void PoseToWorldMatrices(const Pose& pose, orca::affine<float>* worlds);
+#endif // !_POSE_H_
\ No newline at end of file
@@ -0,0 +1,78 @@
+/**********************************/
+/*  FILE NAME: pose_snapshot.cpp  */
+/**********************************/
+#include "pose_snapshot.h"
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+/* bit of the middle slot index set by Publish() and cleared by Acquire() */
+static constexpr unsigned int FRESH = 0x4U;
+static constexpr unsigned int INDEX_MASK = 0x3U;
+
+/* default constructor */
+PoseSnapshot::PoseSnapshot()
+    : texels()
+    , joint_offsets()
+    , bounds()
+    , sequence(0)
+    , update_start(0.0)
+    , update_time(0.0)
+{ /* empty */ }
+
+/* copy constructor */
+PoseSnapshot::PoseSnapshot(const PoseSnapshot& other)
+    : texels(other.texels)
+    , joint_offsets(other.joint_offsets)
+    , bounds(other.bounds)
+    , sequence(other.sequence)
+    , update_start(other.update_start)
+    , update_time(other.update_time)
+{ /* empty */ }
+
+
+/* default constructor */
+PoseExchange::PoseExchange()
+    : slots()
+    , back(0)
+    , front(2)
+    , middle(1)
+    , published(0)
+    , reused(0)
+{ /* empty */ }
+
+/* function to return the slot the writer fills next */
+PoseSnapshot& PoseExchange::Back()
+{
+    return slots[back];
+}
+
+/* function to hand the filled back slot to the reader                         */
+/* (release: the writes to the slot are visible to the Acquire() that takes it) */
+void PoseExchange::Publish()
+{
+    slots[back].sequence = ++published;
+    back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+/* function to return the newest published snapshot, valid until the next Acquire() */
+const PoseSnapshot& PoseExchange::Acquire()
+{
+    if((middle.load(std::memory_order_relaxed) & FRESH) != 0)
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+    else
+        reused += 1;
+    return slots[front];
+}
+
+/* function to return the number of snapshots published */
+unsigned long long PoseExchange::Published() const
+{
+    return published;
+}
+
+/* function to return the number of Acquire() calls that returned the previous snapshot again */
+unsigned long long PoseExchange::Reused() const
+{
+    return reused;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/********************************/
+/*  FILE NAME: pose_snapshot.h  */
+/********************************/
+#ifndef _POSE_SNAPSHOT_H_
+#define _POSE_SNAPSHOT_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <vector.hpp>
+#include "bounds.h"
+
+/******************************/
+/*  CLASS NAME: PoseSnapshot  */
+/******************************/
+/* everything Cull() and Render() read from an animation update: the packed */
+/* joint palette and, per mesh in the order of the model's mesh map, its    */
+/* texel offset in the palette and its skinned bounds (empty when static)   */
+class PoseSnapshot
+{
+public:
+    PoseSnapshot();
+    PoseSnapshot(const PoseSnapshot& other);
+
+public:
+    std::vector<orca::vec4<float>> texels;
+    std::vector<int> joint_offsets;
+    std::vector<BoundingBox> bounds;
+
+    unsigned long long sequence;    /* number of the update that wrote the snapshot */
+    double update_start;            /* steady clock seconds when the update started */
+    double update_time;             /* milliseconds spent in the update             */
+}; // class PoseSnapshot
+
+/******************************/
+/*  CLASS NAME: PoseExchange  */
+/******************************/
+/* lock-free triple buffer of pose snapshots between one writer (the update */
+/* thread) and one reader (the render thread). the writer fills Back() and  */
+/* Publish() swaps it with the middle slot, the reader's Acquire() swaps    */
+/* the middle slot with its front slot if a newer one was published, and   */
+/* returns the same front slot again otherwise. neither side ever waits,   */
+/* and a slot is never written while it is read.                           */
+class PoseExchange
+{
+public:
+    PoseExchange();
+    PoseExchange(const PoseExchange& other) = delete;
+
+public:
+    PoseExchange& operator=(const PoseExchange& rhs) = delete;
+
+public:
+    PoseSnapshot& Back();
+    void Publish();
+    const PoseSnapshot& Acquire();
+
+public:
+    unsigned long long Published() const;
+    unsigned long long Reused() const;
+
+private:
+    PoseSnapshot slots[3];
+    unsigned int back;                  /* writer only */
+    unsigned int front;                 /* reader only */
+    std::atomic<unsigned int> middle;   /* slot index, FRESH once published and not acquired */
+    unsigned long long published;       /* writer only */
+    unsigned long long reused;          /* reader only, Acquire() calls without a newer snapshot */
+}; // class PoseExchange
+#endif // !_POSE_SNAPSHOT_H_
\ No newline at end of file
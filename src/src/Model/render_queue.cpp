@@ -0,0 +1,188 @@
+/*********************************/
+/*  FILE NAME: render_queue.cpp  */
+/*********************************/
+#include "render_queue.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <algorithm>
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+
+/* default constructor */
+RenderStats::RenderStats()
+    : draw_calls(0)
+    , instances(0)
+    , program_changes(0)
+    , texture_changes(0)
+    , vertex_array_changes(0)
+    , uniform_changes(0)
+    , elided_changes(0)
+{ /* empty */ }
+
+/* copy constructor */
+RenderStats::RenderStats(const RenderStats& other)
+    : draw_calls(other.draw_calls)
+    , instances(other.instances)
+    , program_changes(other.program_changes)
+    , texture_changes(other.texture_changes)
+    , vertex_array_changes(other.vertex_array_changes)
+    , uniform_changes(other.uniform_changes)
+    , elided_changes(other.elided_changes)
+{ /* empty */ }
+
+void RenderStats::Reset()
+{
+    *this = RenderStats();
+}
+
+/* function to return the number of state changes sent to OpenGL */
+unsigned int RenderStats::StateChanges() const
+{
+    return program_changes + texture_changes + vertex_array_changes + uniform_changes;
+}
+
+
+/* default constructor */
+DrawItem::DrawItem()
+    : sort_key(0)
+    , program(0)
+    , material_id(-1)
+    , texture(0)
+    , vertex_array(0)
+    , vertex_count(0)
+    , instance_count(1)
+    , joint_offset(-1)
+{ /* empty */ }
+
+/* copy constructor */
+DrawItem::DrawItem(const DrawItem& other)
+    : sort_key(other.sort_key)
+    , program(other.program)
+    , material_id(other.material_id)
+    , texture(other.texture)
+    , vertex_array(other.vertex_array)
+    , vertex_count(other.vertex_count)
+    , instance_count(other.instance_count)
+    , joint_offset(other.joint_offset)
+{ /* empty */ }
+
+/* function to pack the state of the draw into the sort key      */
+/* (16 bits each, most expensive state change in the high bits)  */
+void DrawItem::MakeSortKey()
+{
+    const std::uint64_t material = static_cast<std::uint16_t>(material_id + 1);
+    sort_key = (static_cast<std::uint64_t>(static_cast<std::uint16_t>(program)) << 48)
+             | (material << 32)
+             | (static_cast<std::uint64_t>(static_cast<std::uint16_t>(texture)) << 16)
+             | static_cast<std::uint64_t>(static_cast<std::uint16_t>(vertex_array));
+}
+
+
+/* default constructor */
+RenderQueue::RenderQueue()
+    : items()
+    , stats()
+{ /* empty */ }
+
+/* copy constructor */
+RenderQueue::RenderQueue(const RenderQueue& other)
+    : items(other.items)
+    , stats(other.stats)
+{ /* empty */ }
+
+/* function to remove the draws of the previous frame */
+void RenderQueue::Clear()
+{
+    items.clear();
+}
+
+/* function to add a draw (the sort key is made here) */
+void RenderQueue::Push(const DrawItem& item)
+{
+    items.push_back(item);
+    items.back().MakeSortKey();
+}
+
+/* function to order the draws by their sort key, with scratch memory from 'arena' */
+/* NOTE: stable, so draws with the same state keep push order                      */
+void RenderQueue::Sort(FrameArena& arena)
+{
+    SortByKey(items, arena, [](const DrawItem& item) { return item.sort_key; });
+}
+
+/* function to issue the draws in queue order                                */
+/* NOTE: the state bound before the call is unknown, so the first draw binds */
+/*       everything (GLState still skips what is already bound)             */
+void RenderQueue::Submit(int joint_offset_location)
+{
+    GLState& state = GLState::Get();
+    constexpr unsigned int UNKNOWN = ~0U;
+    unsigned int bound_program = UNKNOWN;
+    unsigned int bound_texture = UNKNOWN;
+    unsigned int bound_vertex_array = UNKNOWN;
+    int bound_joint_offset = -1;
+
+    stats.Reset();
+    for(const auto& item : items)
+    {
+        if(bound_program != item.program)
+        {
+            state.UseProgram(item.program);
+            bound_program = item.program;
+            bound_joint_offset = -1;
+            stats.program_changes += 1;
+        }
+        else stats.elided_changes += 1;
+
+        /* a draw without a texture keeps whatever texture is bound */
+        if(item.texture != 0)
+        {
+            if(bound_texture != item.texture)
+            {
+                state.BindTexture(GL_TEXTURE_2D, item.texture);
+                bound_texture = item.texture;
+                stats.texture_changes += 1;
+            }
+            else stats.elided_changes += 1;
+        }
+
+        if(bound_vertex_array != item.vertex_array)
+        {
+            state.BindVertexArray(item.vertex_array);
+            bound_vertex_array = item.vertex_array;
+            stats.vertex_array_changes += 1;
+        }
+        else stats.elided_changes += 1;
+
+        if(joint_offset_location > -1 && item.joint_offset > -1)
+        {
+            if(bound_joint_offset != item.joint_offset)
+            {
+                glUniform1i(joint_offset_location, item.joint_offset);
+                bound_joint_offset = item.joint_offset;
+                stats.uniform_changes += 1;
+            }
+            else stats.elided_changes += 1;
+        }
+
+        if(item.instance_count > 1)
+            glDrawArraysInstanced(GL_TRIANGLES, 0, item.vertex_count, item.instance_count);
+        else glDrawArrays(GL_TRIANGLES, 0, item.vertex_count);
+        stats.draw_calls += 1;
+        stats.instances += item.instance_count;
+    }
+}
+
+/* function to return the number of queued draws */
+std::size_t RenderQueue::Size() const
+{
+    return items.size();
+}
+
+/* function to return the counters of the last Submit() */
+const RenderStats& RenderQueue::GetStats() const
+{
+    return stats;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+/*******************************/
+/*  FILE NAME: render_queue.h  */
+/*******************************/
+#ifndef _RENDER_QUEUE_H_
+#define _RENDER_QUEUE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <cstdint>
+#include "frame_arena.h"
+
+/*****************************/
+/*  CLASS NAME: RenderStats  */
+/*****************************/
+/* state changes and draw calls issued by RenderQueue::Submit() */
+class RenderStats
+{
+public:
+    RenderStats();
+    RenderStats(const RenderStats& other);
+
+public:
+    RenderStats& operator=(const RenderStats& rhs) = default;
+
+public:
+    void Reset();
+    unsigned int StateChanges() const;
+
+public:
+    unsigned int draw_calls;
+    unsigned int instances;         /* instances drawn by the draw calls */
+    unsigned int program_changes;
+    unsigned int texture_changes;
+    unsigned int vertex_array_changes;
+    unsigned int uniform_changes;
+    unsigned int elided_changes;    /* binds skipped because the state was already set */
+}; // class RenderStats
+
+/**************************/
+/*  CLASS NAME: DrawItem  */
+/**************************/
+class DrawItem
+{
+public:
+    DrawItem();
+    DrawItem(const DrawItem& other);
+
+public:
+    DrawItem& operator=(const DrawItem& rhs) = default;
+
+public:
+    void MakeSortKey();
+
+public:
+    std::uint64_t sort_key;
+    unsigned int program;
+    int material_id;
+    unsigned int texture;       /* base color texture, 0 keeps the bound texture */
+    unsigned int vertex_array;
+    unsigned int vertex_count;
+    unsigned int instance_count;    /* more than 1 draws instanced */
+    int joint_offset;           /* -1 for draws without skinning */
+}; // class DrawItem
+
+/*****************************/
+/*  CLASS NAME: RenderQueue  */
+/*****************************/
+/* draws of a frame sorted by (program, material, texture, vertex array), */
+/* submitted with the binds that would not change any state left out      */
+class RenderQueue
+{
+public:
+    RenderQueue();
+    RenderQueue(const RenderQueue& other);
+
+public:
+    void Clear();
+    void Push(const DrawItem& item);
+    void Sort(FrameArena& arena);
+    void Submit(int joint_offset_location);
+
+public:
+    std::size_t Size() const;
+    const RenderStats& GetStats() const;
+
+private:
+    std::vector<DrawItem> items;
+    RenderStats stats;
+}; // class RenderQueue
+#endif // !_RENDER_QUEUE_H_
\ No newline at end of file
@@ -0,0 +1,511 @@
+/**************************/
+/*  FILE NAME: scene.cpp  */
+/**************************/
+#include "scene.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include "gltf_loader.h"
+#include "Profiler/profiler.h"
+#include <vector_functions.hpp>
+#include <matrix_functions.hpp>
+#include <affine_functions.hpp>
+#include <quaternion_functions.hpp>
+#include <dual_quaternion_functions.hpp>
+
+/* default constructor */
+Scene::Scene()
+    : curr_animation(0)
+    , skinning_type(SKINNING_TYPE::LINEAR)
+    , total_time(0.0)
+    , meshes()
+    , nodes()
+    , skins(std::make_shared<const std::map<int, Skin>>())
+    , animations(std::make_shared<const std::map<int, Animation>>())
+    , textures()
+    , materials(std::make_shared<const std::map<int, Material>>())
+    , pose()
+    , pose_node_ids()
+    , matrix_pose_ids()
+    , node_matrices()
+    , joint_palette()
+{ /* empty */ }
+
+/* function to load a file in glTF format */
+void Scene::LoadScene(const std::string& file)
+{
+    PROFILE_ZONE("Scene::LoadScene", "load");
+    tinygltf::Model gltf_model;
+    LoadglTFModel(gltf_model, file);
+
+    /* NOTE: the loaded parts are moved into the maps, the scratch of the */
+    /*       loader is reused from mesh to mesh and freed with the load   */
+    FrameArena scratch;
+
+    /* load the mesh data */
+    for(std::size_t i = 0; i < gltf_model.meshes.size(); ++i)
+    {
+        scratch.Reset();
+        meshes.emplace(static_cast<int>(i), LoadglTFMesh(gltf_model, gltf_model.meshes[i], scratch));
+    }
+
+    /* load the node data                                */
+    /* NOTE: only store node data from the default scene */
+    const tinygltf::Scene& scene = gltf_model.scenes[gltf_model.defaultScene];
+    for(std::size_t i = 0; i < scene.nodes.size(); ++i)
+    {
+        LoadglTFNode(gltf_model, gltf_model.nodes[scene.nodes[i]], -1, scene.nodes[i], nodes);
+    }
+
+    /* save the matrix information of the mesh */
+    for(std::size_t i= 0; i < nodes.size(); ++i)
+    {
+        if(nodes[i].mesh_id > -1)
+        {
+            meshes[nodes[i].mesh_id].matrix = nodes[i].matrix;
+        }
+    }
+
+    /* load the texture data */
+    for(std::size_t i = 0; i < gltf_model.textures.size(); ++i)
+    {
+        textures.emplace(static_cast<int>(i), LoadglTFTexture(gltf_model, gltf_model.textures[i]));
+    }
+    
+    /* load the material data */
+    std::map<int, Material> loaded_materials;
+    for(std::size_t i = 0; i < gltf_model.materials.size(); ++i)
+    {
+        loaded_materials.emplace(static_cast<int>(i), LoadglTFMaterial(gltf_model, gltf_model.materials[i]));
+    }
+    
+    /* NOTE: color textures are sRGB encoded, their mips are averaged in linear light */
+    for(const auto& material : loaded_materials)
+    {
+        const int color_texture_ids[] = 
+        {
+            material.second.base_color_texture_id,
+            material.second.emissive_texture_id,
+            material.second.extension.diffuse_texture_id,
+            material.second.extension.specular_glossiness_texture_id
+        };
+        for(int texture_id : color_texture_ids)
+        {
+            if(textures.count(texture_id) > 0)
+                textures[texture_id].srgb = true;
+        }
+    }
+
+    /* load the animation data */
+    std::map<int, Animation> loaded_animations;
+    for(std::size_t i = 0; i < gltf_model.animations.size(); ++i)
+    {
+        loaded_animations.emplace(static_cast<int>(i), LoadglTFAnimation(gltf_model, gltf_model.animations[i]));
+    }
+
+    /* load the skin data */
+    std::map<int, Skin> loaded_skins;
+    for(std::size_t i = 0; i < gltf_model.skins.size(); ++i)
+    {
+        loaded_skins.emplace(static_cast<int>(i), LoadglTFSkin(gltf_model, gltf_model.skins[i]));
+    }
+
+    /* NOTE: from here on they are only read, instances of the scene share them */
+    materials = std::make_shared<const std::map<int, Material>>(std::move(loaded_materials));
+    animations = std::make_shared<const std::map<int, Animation>>(std::move(loaded_animations));
+    skins = std::make_shared<const std::map<int, Skin>>(std::move(loaded_skins));
+
+    /* lay out the nodes for the batched matrix update */
+    SetupPose();
+}
+
+/* function to make this scene an instance of 'source' (a loaded scene) that animates on its own: */
+/* the skins, animations and materials are shared, the nodes and the animation state copied.     */
+/* NOTE: the meshes are copied without their vertices, indices and GL objects and there are no   */
+/*       textures, they stay with 'source' (see ModelAsset)                                      */
+void Scene::Instantiate(const Scene& source)
+{
+    curr_animation = source.curr_animation;
+    skinning_type = source.skinning_type;
+    total_time = source.total_time;
+
+    meshes.clear();
+    for(const auto& source_mesh : source.meshes)
+        meshes.emplace(source_mesh.first, source_mesh.second.MakeInstance());
+    nodes = source.nodes;
+    skins = source.skins;
+    animations = source.animations;
+    textures.clear();
+    materials = source.materials;
+
+    pose = source.pose;
+    pose_node_ids = source.pose_node_ids;
+    matrix_pose_ids = source.matrix_pose_ids;
+    node_matrices = source.node_matrices;
+    joint_palette = source.joint_palette;
+}
+
+/* function to advance the animation of the scene by 'delta_time' seconds */
+void Scene::Update(double delta_time)
+{
+    total_time += delta_time;
+
+    if(animations->size() > 0)
+    {
+        /* NOTE: only the first animation is used */
+        UpdateAnimation(total_time);
+    }
+}
+
+/* function to copy what the render needs from the last Update() into 'snapshot' */
+/* NOTE: the vectors of the snapshot keep their capacity, so once they have     */
+/*       grown to the model no memory is allocated                              */
+void Scene::WriteSnapshot(PoseSnapshot& snapshot) const
+{
+    const auto& texels = joint_palette.GetTexels();
+    snapshot.texels.assign(texels.begin(), texels.end());
+    snapshot.joint_offsets.resize(meshes.size());
+    snapshot.bounds.resize(meshes.size());
+
+    std::size_t index = 0;
+    for(const auto& mesh : meshes)
+    {
+        snapshot.joint_offsets[index] = mesh.second.joint_offset;
+        snapshot.bounds[index] = (mesh.second.joint_matrices.empty() == false) ? mesh.second.bounds : BoundingBox();
+        index += 1;
+    }
+}
+
+/* function to set the nodes to the keys of an animation at 'time' and update */
+/* the joints of the meshes (the palette is left as it is)                     */
+void Scene::SamplePose(int animation_id, float time)
+{
+    SampleAnimation(animations->at(animation_id), time, nodes);
+    UpdateJoints();
+}
+
+/* function to recompute the world matrices of the nodes and the joints of the */
+/* skinned meshes from the current node transforms (the palette is left as it is) */
+void Scene::UpdateJoints()
+{
+    UpdatePose();
+    UpdateNode(0);
+}
+
+/* function to restore nodes saved with GetNodes() and update the joints and the palette */
+void Scene::SetNodes(const std::map<int, Node>& nodes)
+{
+    this->nodes = nodes;
+    UpdateJoints();
+    UpdatePalette();
+}
+
+bool Scene::IsAnimated() const
+{
+    return (animations->size() > 0 && skins->size() > 0);
+}
+
+void Scene::ChangeAnimation(int num)
+{
+    curr_animation = std::clamp<size_t>(curr_animation + num, 0, animations->size() - 1);
+}
+
+/* function to return the skinning method used by the mesh shader */
+SKINNING_TYPE Scene::GetSkinningType() const
+{
+    return IsAnimated() ? skinning_type : SKINNING_TYPE::NONE;
+}
+
+/* function to select the skinning method of the model                   */
+/* NOTE: dual quaternion skinning drops the scale of the joints, so it   */
+/*       falls back to linear skinning if the joints are not rigid       */
+void Scene::SetSkinningType(SKINNING_TYPE type)
+{
+    if(type == SKINNING_TYPE::NONE)
+        throw std::runtime_error("skinning type error: an animated model needs a skinning type.");
+
+    if(IsAnimated() == false)
+        return;
+
+    /* NOTE: the joint matrices of the current pose are checked */
+    UpdateNode(0);
+    if(type == SKINNING_TYPE::DUAL_QUATERNION && IsRigidSkinning() == false)
+        type = SKINNING_TYPE::LINEAR;
+
+    skinning_type = type;
+    UpdateNode(0);
+    UpdatePalette();
+}
+
+/* function to check if every joint matrix is a rotation and a translation */
+/* (the bind pose and the scale keys of the animations are checked)        */
+bool Scene::IsRigidSkinning() const
+{
+    constexpr float tolerance = 1.0e-3f;
+
+    for(const auto& animation : *animations)
+    {
+        for(const auto& channel : animation.second.channels)
+        {
+            if(channel.path_type != PATH_TYPE::SCALE)
+                continue;
+
+            for(const auto& scale : animation.second.samplers[channel.sampler_id].outputs)
+            {
+                if(std::abs(scale.x - 1.0f) > tolerance || std::abs(scale.y - 1.0f) > tolerance || std::abs(scale.z - 1.0f) > tolerance)
+                    return false;
+            }
+        }
+    }
+
+    for(const auto& mesh : meshes)
+    {
+        for(const auto& joint_matrix : mesh.second.joint_matrices)
+        {
+            for(unsigned int j = 0; j < 3; ++j)
+            {
+                const float squared = joint_matrix.data[0].data[j] * joint_matrix.data[0].data[j]
+                                    + joint_matrix.data[1].data[j] * joint_matrix.data[1].data[j]
+                                    + joint_matrix.data[2].data[j] * joint_matrix.data[2].data[j];
+                if(std::abs(squared - 1.0f) > tolerance)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::map<int, Mesh>& Scene::GetMeshes()
+{
+    return meshes;
+}
+
+const std::map<int, Mesh>& Scene::GetMeshes() const
+{
+    return meshes;
+}
+
+std::map<int, Texture>& Scene::GetTextures()
+{
+    return textures;
+}
+
+const std::map<int, Texture>& Scene::GetTextures() const
+{
+    return textures;
+}
+
+const std::map<int, Material>& Scene::GetMaterials() const
+{
+    return *materials;
+}
+
+const std::map<int, Node>& Scene::GetNodes() const
+{
+    return nodes;
+}
+
+const std::map<int, Animation>& Scene::GetAnimations() const
+{
+    return *animations;
+}
+
+/* function to return the joints packed by the last update (see JointPalette) */
+const std::vector<orca::vec4<float>>& Scene::GetPaletteTexels() const
+{
+    return joint_palette.GetTexels();
+}
+
+/* function to return the CPU bytes of the loaded data and the animation state */
+/* NOTE: the mip levels being streamed are counted by Model, not here. the      */
+/*       data shared with instances is counted by every scene sharing it       */
+MemoryUsage Scene::GetMemoryUsage() const
+{
+    MemoryUsage usage = GetStateMemoryUsage();
+    for(const auto& mesh : meshes)
+    {
+        usage.AddCpu(MEMORY_CATEGORY::VERTICES, VectorBytes(mesh.second.vertices));
+        usage.AddCpu(MEMORY_CATEGORY::INDICES, VectorBytes(mesh.second.indices));
+    }
+    for(const auto& texture : textures)
+        usage.AddCpu(MEMORY_CATEGORY::TEXTURES, VectorBytes(texture.second.image.data));
+    for(const auto& animation : *animations)
+    {
+        usage.AddCpu(MEMORY_CATEGORY::ANIMATIONS, VectorBytes(animation.second.samplers));
+        usage.AddCpu(MEMORY_CATEGORY::ANIMATIONS, VectorBytes(animation.second.channels));
+        for(const auto& sampler : animation.second.samplers)
+        {
+            usage.AddCpu(MEMORY_CATEGORY::ANIMATIONS, VectorBytes(sampler.inputs));
+            usage.AddCpu(MEMORY_CATEGORY::ANIMATIONS, VectorBytes(sampler.outputs));
+        }
+    }
+    for(const auto& skin : *skins)
+    {
+        usage.AddCpu(MEMORY_CATEGORY::SKINS, VectorBytes(skin.second.joints));
+        usage.AddCpu(MEMORY_CATEGORY::SKINS, VectorBytes(skin.second.inverse_bind_matrices));
+    }
+    return usage;
+}
+
+/* function to return the CPU bytes that each instance of the scene holds on its own */
+MemoryUsage Scene::GetStateMemoryUsage() const
+{
+    MemoryUsage usage;
+    for(const auto& mesh : meshes)
+    {
+        usage.AddCpu(MEMORY_CATEGORY::SKINS, VectorBytes(mesh.second.joint_bounds));
+        usage.AddCpu(MEMORY_CATEGORY::PALETTES, VectorBytes(mesh.second.joint_matrices));
+        usage.AddCpu(MEMORY_CATEGORY::PALETTES, VectorBytes(mesh.second.joint_dual_quaternions));
+    }
+
+    /* the pose sampled from the animations and the node matrices it makes */
+    const std::vector<float>* pose_arrays[] = { &pose.translate_x, &pose.translate_y, &pose.translate_z,
+                                                &pose.rotate_x, &pose.rotate_y, &pose.rotate_z, &pose.rotate_w,
+                                                &pose.scale_x, &pose.scale_y, &pose.scale_z };
+    for(const auto* pose_array : pose_arrays)
+        usage.AddCpu(MEMORY_CATEGORY::ANIMATIONS, VectorBytes(*pose_array));
+    usage.AddCpu(MEMORY_CATEGORY::ANIMATIONS, VectorBytes(pose.parents) + VectorBytes(pose_node_ids) + VectorBytes(matrix_pose_ids));
+    usage.AddCpu(MEMORY_CATEGORY::ANIMATIONS, VectorBytes(node_matrices));
+
+    usage.AddCpu(MEMORY_CATEGORY::PALETTES, VectorBytes(joint_palette.GetTexels()));
+    return usage;
+}
+
+/* function to lay out the nodes as a pose (parents before children) */
+void Scene::SetupPose()
+{
+    pose_node_ids.clear();
+    matrix_pose_ids.clear();
+
+    for(const auto& node : nodes)
+    {
+        if(node.second.parent_id == -1)
+            pose_node_ids.push_back(node.first);
+    }
+
+    for(std::size_t i = 0; i < pose_node_ids.size(); ++i)
+    {
+        for(auto child : nodes[pose_node_ids[i]].child_ids)
+            pose_node_ids.push_back(child);
+    }
+
+    const orca::affine<float> identity;
+    pose.Resize(pose_node_ids.size());
+    for(std::size_t i = 0; i < pose_node_ids.size(); ++i)
+    {
+        auto& node = nodes[pose_node_ids[i]];
+        node.pose_id = static_cast<int>(i);
+        pose.parents[i] = (node.parent_id == -1) ? -1 : nodes[node.parent_id].pose_id;
+        pose.SetJoint(i, node.translate, node.rotate, node.scale);
+
+        /* nodes with a matrix are multiplied separately */
+        if(std::memcmp(&node.matrix, &identity, sizeof(identity)) != 0)
+            matrix_pose_ids.push_back(static_cast<int>(i));
+    }
+
+    node_matrices.resize(pose.Size());
+    UpdatePose();
+}
+
+/* function to recompute the world matrices of all nodes */
+void Scene::UpdatePose()
+{
+    for(std::size_t i = 0; i < pose_node_ids.size(); ++i)
+    {
+        const auto& node = nodes[pose_node_ids[i]];
+        pose.SetJoint(i, node.translate, node.rotate, node.scale);
+    }
+
+    PoseToLocalMatrices(pose, node_matrices.data());
+    for(auto id : matrix_pose_ids)
+    {
+        node_matrices[id] = nodes[pose_node_ids[id]].matrix * node_matrices[id];
+    }
+    LocalToWorldMatrices(pose, node_matrices.data(), node_matrices.data());
+}
+
+/* function to return matrix information of node */
+/* NOTE: valid after UpdatePose()                 */
+orca::affine<float> Scene::GetNodeMatrix(int node_id)
+{
+    const auto& node = nodes[node_id];
+    if(node.pose_id < 0)
+        return node.LocalMatrix();
+    return node_matrices[node.pose_id];
+}
+
+/* function to update the animation of the model */
+void Scene::UpdateAnimation(double duration)
+{
+    PROFILE_ZONE("Scene::UpdateAnimation", "animation");
+    if (curr_animation >= animations->size())   
+        throw std::runtime_error("animation id error: out of range.");
+
+    const Animation& animation = animations->at(static_cast<int>(curr_animation));
+    float time = std::fmod(static_cast<float>(duration), animation.end_time - animation.start_time);
+
+    if(SampleAnimation(animation, time, nodes) == true)
+    {
+        UpdateJoints();
+        UpdatePalette();
+    }
+}
+
+/* function to update the transformation information of a node */
+void Scene::UpdateNode(int node_id)
+{
+    PROFILE_ZONE("Scene::UpdateNode", "animation");
+    auto& node = nodes[node_id];
+    if(node.mesh_id > -1)
+    {
+        /* NOTE: at(), the map is walked by the render thread at the same time */
+        auto& mesh = meshes.at(node.mesh_id);
+        mesh.matrix = GetNodeMatrix(node_id);
+        if(node.skin_id > -1)
+        {
+            const auto& skin = skins->at(node.skin_id);
+            /* NOTE: affine inverse, a singular mesh matrix falls back to the identity */
+            auto inverse_transform = orca::Inverse(mesh.matrix);
+            const std::size_t num_joints = skin.joints.size();
+            mesh.joint_matrices.resize(num_joints);
+            for(std::size_t i = 0; i < num_joints; ++i)
+            {
+                /* NOTE: Reference: https://github.com/KhronosGroup/glTF-Tutorials/blob/master/gltfTutorial/gltfTutorial_020_Skins.md */
+                auto joint_mat = skin.inverse_bind_matrices[i] * GetNodeMatrix(skin.joints[i]) * inverse_transform;
+                mesh.joint_matrices[i] = joint_mat;
+            }
+            mesh.bounds = SkinBounds(mesh.joint_bounds, mesh.joint_matrices);
+
+            /* NOTE: the dual quaternion palette is converted on the CPU once per update */
+            if(skinning_type == SKINNING_TYPE::DUAL_QUATERNION)
+            {
+                mesh.joint_dual_quaternions.resize(num_joints);
+                for(std::size_t i = 0; i < num_joints; ++i)
+                    mesh.joint_dual_quaternions[i] = orca::MakeDualQuaternion(mesh.joint_matrices[i]);
+            }
+        }
+    }
+
+    for(auto child : node.child_ids)
+    {
+        UpdateNode(child);
+    }
+}
+
+/* function to pack the joints of every skinned mesh into the joint palette */
+void Scene::UpdatePalette()
+{
+    joint_palette.Clear();
+    for(auto& mesh : meshes)
+    {
+        if(skinning_type == SKINNING_TYPE::DUAL_QUATERNION && mesh.second.joint_dual_quaternions.empty() == false)
+            mesh.second.joint_offset = joint_palette.Append(mesh.second.joint_dual_quaternions);
+        else if(skinning_type == SKINNING_TYPE::LINEAR && mesh.second.joint_matrices.empty() == false)
+            mesh.second.joint_offset = joint_palette.Append(mesh.second.joint_matrices);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+/************************/
+/*  FILE NAME: scene.h  */
+/************************/
+#ifndef _SCENE_H_
+#define _SCENE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+
+#include "mesh.h"
+#include "node.h"
+#include "pose.h"
+#include "joint_palette.h"
+#include "pose_snapshot.h"
+#include "skin.h"
+#include "animation.h"
+#include "texture.h"
+#include "material.h"
+#include "memory_usage.h"
+
+/***********************/
+/*  CLASS NAME: Scene  */
+/***********************/
+/* the CPU side of a glTF model: its meshes, node hierarchy, skins,         */
+/* animations, materials and texture images as loaded, and the animation    */
+/* state evaluated from them (node matrices, joints, packed palette).       */
+/* nothing here calls OpenGL, ModelAsset sets up the GL resources of the   */
+/* meshes and textures and Model draws them, so a Scene alone runs without  */
+/* a GL context.                                                            */
+/* it is not copyable, its meshes and textures own their GL objects. an    */
+/* instance of a loaded scene (Instantiate()) shares its skins, animations */
+/* and materials, which are not changed after the load, and animates alone. */
+class Scene
+{
+public:
+    Scene();
+    Scene(const Scene& other) = delete;
+
+public:
+    Scene& operator=(const Scene& rhs) = delete;
+
+public:
+    void LoadScene(const std::string& file);
+    void Instantiate(const Scene& source);
+    void Update(double delta_time);
+    void WriteSnapshot(PoseSnapshot& snapshot) const;
+    void SamplePose(int animation_id, float time);
+    void SetNodes(const std::map<int, Node>& nodes);
+    void UpdateJoints();
+    void UpdatePalette();
+
+public:
+    bool IsAnimated() const;
+    void ChangeAnimation(int num);
+    SKINNING_TYPE GetSkinningType() const;
+    void SetSkinningType(SKINNING_TYPE type);
+    bool IsRigidSkinning() const;
+    std::map<int, Mesh>& GetMeshes();
+    const std::map<int, Mesh>& GetMeshes() const;
+    std::map<int, Texture>& GetTextures();
+    const std::map<int, Texture>& GetTextures() const;
+    const std::map<int, Material>& GetMaterials() const;
+    const std::map<int, Node>& GetNodes() const;
+    const std::map<int, Animation>& GetAnimations() const;
+    const std::vector<orca::vec4<float>>& GetPaletteTexels() const;
+    MemoryUsage GetMemoryUsage() const;
+    MemoryUsage GetStateMemoryUsage() const;
+
+private:
+    void SetupPose();
+    void UpdatePose();
+    orca::affine<float> GetNodeMatrix(int node_id);
+    void UpdateAnimation(double duration);
+    void UpdateNode(int node_id);
+
+private:
+    size_t curr_animation;
+    SKINNING_TYPE skinning_type;
+    double total_time;
+    std::map<int, Mesh> meshes;
+    std::map<int, Node> nodes;
+    std::shared_ptr<const std::map<int, Skin>> skins;           /* shared with the instances */
+    std::shared_ptr<const std::map<int, Animation>> animations; /* shared with the instances */
+    std::map<int, Texture> textures;
+    std::shared_ptr<const std::map<int, Material>> materials;   /* shared with the instances */
+
+    Pose pose;
+    std::vector<int> pose_node_ids;
+    std::vector<int> matrix_pose_ids;
+    std::vector<orca::affine<float>> node_matrices;
+    JointPalette joint_palette;     /* only packed here, uploaded from a PoseSnapshot by Model */
+}; // class Scene
+#endif // !_SCENE_H_
\ No newline at end of file
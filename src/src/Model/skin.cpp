@@ -3,6 +3,11 @@
 /*************************/
 #include "skin.h"
 
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <utility>
+
 /* default constructor */
 Skin::Skin()
     : name()
@@ -19,4 +24,12 @@ Skin::Skin(const Skin& other)
     , joints(other.joints)
     , inverse_bind_matrices(other.inverse_bind_matrices)
     , skeleton_root_id(other.skeleton_root_id)
+{ /* empty */ }
+
+/* move constructor */
+Skin::Skin(Skin&& other) noexcept
+    : name(std::move(other.name))
+    , joints(std::move(other.joints))
+    , inverse_bind_matrices(std::move(other.inverse_bind_matrices))
+    , skeleton_root_id(other.skeleton_root_id)
 { /* empty */ }
\ No newline at end of file
@@ -20,11 +20,16 @@ class Skin
 public:
     Skin();
     Skin(const Skin& other);
+    Skin(Skin&& other) noexcept;
+
+public:
+    Skin& operator=(const Skin& rhs) = default;
+    Skin& operator=(Skin&& rhs) noexcept = default;
 
 public:
     std::string name;
     std::vector<int> joints;
-    std::vector<orca::mat4<float>> inverse_bind_matrices;
+    std::vector<orca::affine<float>> inverse_bind_matrices;
     int skeleton_root_id;
 }; // class Skin 
 #endif // !_SKIN_H_
\ No newline at end of file
@@ -0,0 +1,310 @@
+/*****************************/
+/*  FILE NAME: skinning.cpp  */
+/*****************************/
+#include "skinning.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <algorithm>
+#include <simd.hpp>
+
+/* skin a single vertex                                                 */
+/* NOTE: the SIMD paths below use the same operations in the same order */
+inline void SkinVertex(const Vertex& vertex, const orca::affine<float>* joint_matrices, orca::vec3<float>* position, orca::vec3<float>* normal)
+{
+    const orca::affine<float>& joint0 = joint_matrices[vertex.joint.x];
+    const orca::affine<float>& joint1 = joint_matrices[vertex.joint.y];
+    const orca::affine<float>& joint2 = joint_matrices[vertex.joint.z];
+    const orca::affine<float>& joint3 = joint_matrices[vertex.joint.w];
+
+    float skin[3][4];
+    for(unsigned int r = 0; r < 3; ++r)
+    {
+        for(unsigned int c = 0; c < 4; ++c)
+        {
+            skin[r][c] = joint0.data[r].data[c] * vertex.weight.x + joint1.data[r].data[c] * vertex.weight.y
+                       + joint2.data[r].data[c] * vertex.weight.z + joint3.data[r].data[c] * vertex.weight.w;
+        }
+    }
+
+    float n[3];
+    for(unsigned int r = 0; r < 3; ++r)
+    {
+        position->data[r] = skin[r][0] * vertex.position.x + skin[r][1] * vertex.position.y + skin[r][2] * vertex.position.z + skin[r][3];
+        n[r] = skin[r][0] * vertex.normal.x + skin[r][1] * vertex.normal.y + skin[r][2] * vertex.normal.z;
+    }
+
+    const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    for(unsigned int r = 0; r < 3; ++r)
+        normal->data[r] = (length > 0.0f) ? n[r] / length : n[r];
+}
+
+/* function to skin the vertices with the joint palette on the calling thread.         */
+/* the SIMD paths blend the joint matrices row by row, then transpose them to skin 4   */
+/* (SSE2) or 8 (AVX2) vertices per iteration.                                          */
+/* NOTE: every joint index of the vertices must be a valid index of 'joint_matrices'   */
+void SkinVertices(const Vertex* vertices, std::size_t count, const orca::affine<float>* joint_matrices, orca::vec3<float>* positions, orca::vec3<float>* normals)
+{
+    std::size_t i = 0;
+
+#if defined(ORCA_SIMD_AVX2)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        alignas(32) float out[6][8];
+        for(; i + 8 <= count; i += 8)
+        {
+            const Vertex* v = vertices + i;
+
+            /* rows[r][k]: row r of the blended matrix of vertex k (low lane) and vertex k + 4 (high lane) */
+            __m256 rows[3][4];
+            for(unsigned int k = 0; k < 4; ++k)
+            {
+                const Vertex& lo = v[k];
+                const Vertex& hi = v[k + 4];
+                const __m256 w0 = _mm256_setr_ps(lo.weight.x, lo.weight.x, lo.weight.x, lo.weight.x, hi.weight.x, hi.weight.x, hi.weight.x, hi.weight.x);
+                const __m256 w1 = _mm256_setr_ps(lo.weight.y, lo.weight.y, lo.weight.y, lo.weight.y, hi.weight.y, hi.weight.y, hi.weight.y, hi.weight.y);
+                const __m256 w2 = _mm256_setr_ps(lo.weight.z, lo.weight.z, lo.weight.z, lo.weight.z, hi.weight.z, hi.weight.z, hi.weight.z, hi.weight.z);
+                const __m256 w3 = _mm256_setr_ps(lo.weight.w, lo.weight.w, lo.weight.w, lo.weight.w, hi.weight.w, hi.weight.w, hi.weight.w, hi.weight.w);
+                for(unsigned int r = 0; r < 3; ++r)
+                {
+                    const __m256 j0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(joint_matrices[lo.joint.x].data[r].data)), _mm_load_ps(joint_matrices[hi.joint.x].data[r].data), 1);
+                    const __m256 j1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(joint_matrices[lo.joint.y].data[r].data)), _mm_load_ps(joint_matrices[hi.joint.y].data[r].data), 1);
+                    const __m256 j2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(joint_matrices[lo.joint.z].data[r].data)), _mm_load_ps(joint_matrices[hi.joint.z].data[r].data), 1);
+                    const __m256 j3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(joint_matrices[lo.joint.w].data[r].data)), _mm_load_ps(joint_matrices[hi.joint.w].data[r].data), 1);
+                    __m256 sum = _mm256_add_ps(_mm256_mul_ps(j0, w0), _mm256_mul_ps(j1, w1));
+                    sum = _mm256_add_ps(sum, _mm256_mul_ps(j2, w2));
+                    rows[r][k] = _mm256_add_ps(sum, _mm256_mul_ps(j3, w3));
+                }
+            }
+
+            /* transpose to one matrix element of 8 vertices */
+            for(unsigned int r = 0; r < 3; ++r)
+            {
+                const __m256 t0 = _mm256_unpacklo_ps(rows[r][0], rows[r][1]);
+                const __m256 t1 = _mm256_unpackhi_ps(rows[r][0], rows[r][1]);
+                const __m256 t2 = _mm256_unpacklo_ps(rows[r][2], rows[r][3]);
+                const __m256 t3 = _mm256_unpackhi_ps(rows[r][2], rows[r][3]);
+                rows[r][0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                rows[r][1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                rows[r][2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                rows[r][3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            }
+
+            const __m256 px = _mm256_setr_ps(v[0].position.x, v[1].position.x, v[2].position.x, v[3].position.x, v[4].position.x, v[5].position.x, v[6].position.x, v[7].position.x);
+            const __m256 py = _mm256_setr_ps(v[0].position.y, v[1].position.y, v[2].position.y, v[3].position.y, v[4].position.y, v[5].position.y, v[6].position.y, v[7].position.y);
+            const __m256 pz = _mm256_setr_ps(v[0].position.z, v[1].position.z, v[2].position.z, v[3].position.z, v[4].position.z, v[5].position.z, v[6].position.z, v[7].position.z);
+            const __m256 nx = _mm256_setr_ps(v[0].normal.x, v[1].normal.x, v[2].normal.x, v[3].normal.x, v[4].normal.x, v[5].normal.x, v[6].normal.x, v[7].normal.x);
+            const __m256 ny = _mm256_setr_ps(v[0].normal.y, v[1].normal.y, v[2].normal.y, v[3].normal.y, v[4].normal.y, v[5].normal.y, v[6].normal.y, v[7].normal.y);
+            const __m256 nz = _mm256_setr_ps(v[0].normal.z, v[1].normal.z, v[2].normal.z, v[3].normal.z, v[4].normal.z, v[5].normal.z, v[6].normal.z, v[7].normal.z);
+
+            __m256 n[3];
+            for(unsigned int r = 0; r < 3; ++r)
+            {
+                __m256 p = _mm256_add_ps(_mm256_mul_ps(rows[r][0], px), _mm256_mul_ps(rows[r][1], py));
+                p = _mm256_add_ps(p, _mm256_mul_ps(rows[r][2], pz));
+                _mm256_store_ps(out[r], _mm256_add_ps(p, rows[r][3]));
+                n[r] = _mm256_add_ps(_mm256_mul_ps(rows[r][0], nx), _mm256_mul_ps(rows[r][1], ny));
+                n[r] = _mm256_add_ps(n[r], _mm256_mul_ps(rows[r][2], nz));
+            }
+
+            __m256 length = _mm256_add_ps(_mm256_mul_ps(n[0], n[0]), _mm256_mul_ps(n[1], n[1]));
+            length = _mm256_sqrt_ps(_mm256_add_ps(length, _mm256_mul_ps(n[2], n[2])));
+            const __m256 mask = _mm256_cmp_ps(length, zero, _CMP_GT_OQ);
+            for(unsigned int r = 0; r < 3; ++r)
+                _mm256_store_ps(out[r + 3], _mm256_blendv_ps(n[r], _mm256_div_ps(n[r], length), mask));
+
+            for(unsigned int k = 0; k < 8; ++k)
+            {
+                positions[i + k] = orca::vec3<float>(out[0][k], out[1][k], out[2][k]);
+                normals[i + k] = orca::vec3<float>(out[3][k], out[4][k], out[5][k]);
+            }
+        }
+    }
+#endif
+
+#if defined(ORCA_SIMD_SSE2)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        alignas(16) float out[6][4];
+        for(; i + 4 <= count; i += 4)
+        {
+            const Vertex* v = vertices + i;
+
+            /* rows[r][k]: row r of the blended matrix of vertex k */
+            __m128 rows[3][4];
+            for(unsigned int k = 0; k < 4; ++k)
+            {
+                const __m128 w0 = _mm_set1_ps(v[k].weight.x);
+                const __m128 w1 = _mm_set1_ps(v[k].weight.y);
+                const __m128 w2 = _mm_set1_ps(v[k].weight.z);
+                const __m128 w3 = _mm_set1_ps(v[k].weight.w);
+                const orca::affine<float>& joint0 = joint_matrices[v[k].joint.x];
+                const orca::affine<float>& joint1 = joint_matrices[v[k].joint.y];
+                const orca::affine<float>& joint2 = joint_matrices[v[k].joint.z];
+                const orca::affine<float>& joint3 = joint_matrices[v[k].joint.w];
+                for(unsigned int r = 0; r < 3; ++r)
+                {
+                    __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_load_ps(joint0.data[r].data), w0), _mm_mul_ps(_mm_load_ps(joint1.data[r].data), w1));
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(joint2.data[r].data), w2));
+                    rows[r][k] = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(joint3.data[r].data), w3));
+                }
+            }
+
+            /* transpose to one matrix element of 4 vertices */
+            for(unsigned int r = 0; r < 3; ++r)
+                _MM_TRANSPOSE4_PS(rows[r][0], rows[r][1], rows[r][2], rows[r][3]);
+
+            const __m128 px = _mm_setr_ps(v[0].position.x, v[1].position.x, v[2].position.x, v[3].position.x);
+            const __m128 py = _mm_setr_ps(v[0].position.y, v[1].position.y, v[2].position.y, v[3].position.y);
+            const __m128 pz = _mm_setr_ps(v[0].position.z, v[1].position.z, v[2].position.z, v[3].position.z);
+            const __m128 nx = _mm_setr_ps(v[0].normal.x, v[1].normal.x, v[2].normal.x, v[3].normal.x);
+            const __m128 ny = _mm_setr_ps(v[0].normal.y, v[1].normal.y, v[2].normal.y, v[3].normal.y);
+            const __m128 nz = _mm_setr_ps(v[0].normal.z, v[1].normal.z, v[2].normal.z, v[3].normal.z);
+
+            __m128 n[3];
+            for(unsigned int r = 0; r < 3; ++r)
+            {
+                __m128 p = _mm_add_ps(_mm_mul_ps(rows[r][0], px), _mm_mul_ps(rows[r][1], py));
+                p = _mm_add_ps(p, _mm_mul_ps(rows[r][2], pz));
+                _mm_store_ps(out[r], _mm_add_ps(p, rows[r][3]));
+                n[r] = _mm_add_ps(_mm_mul_ps(rows[r][0], nx), _mm_mul_ps(rows[r][1], ny));
+                n[r] = _mm_add_ps(n[r], _mm_mul_ps(rows[r][2], nz));
+            }
+
+            __m128 length = _mm_add_ps(_mm_mul_ps(n[0], n[0]), _mm_mul_ps(n[1], n[1]));
+            length = _mm_sqrt_ps(_mm_add_ps(length, _mm_mul_ps(n[2], n[2])));
+            const __m128 mask = _mm_cmpgt_ps(length, zero);
+            for(unsigned int r = 0; r < 3; ++r)
+                _mm_store_ps(out[r + 3], orca::simd::Select(mask, _mm_div_ps(n[r], length), n[r]));
+
+            for(unsigned int k = 0; k < 4; ++k)
+            {
+                positions[i + k] = orca::vec3<float>(out[0][k], out[1][k], out[2][k]);
+                normals[i + k] = orca::vec3<float>(out[3][k], out[4][k], out[5][k]);
+            }
+        }
+    }
+#endif
+
+    /* remaining vertices (all vertices in the scalar build) */
+    for(; i < count; ++i)
+        SkinVertex(vertices[i], joint_matrices, &positions[i], &normals[i]);
+}
+
+
+/* default constructor (one thread per hardware thread) */
+CpuSkinning::CpuSkinning()
+    : CpuSkinning(std::max(1U, std::thread::hardware_concurrency()))
+{ /* empty */ }
+
+/* constructor */
+CpuSkinning::CpuSkinning(unsigned int num_threads)
+    : workers()
+    , mutex()
+    , start_condition()
+    , done_condition()
+    , generation(0)
+    , num_pending(0)
+    , stop(false)
+    , job_vertices(nullptr)
+    , job_count(0)
+    , job_joint_matrices(nullptr)
+    , job_positions(nullptr)
+    , job_normals(nullptr)
+{
+    /* the calling thread is thread 0 */
+    for(unsigned int i = 1; i < std::max(1U, num_threads); ++i)
+        workers.emplace_back(&CpuSkinning::WorkerLoop, this, i);
+}
+
+/* destructor */
+CpuSkinning::~CpuSkinning()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    start_condition.notify_all();
+    for(auto& worker : workers)
+        worker.join();
+}
+
+/* function to skin the vertices with the joint palette using every thread */
+void CpuSkinning::Skin(const Vertex* vertices, std::size_t count, const orca::affine<float>* joint_matrices, orca::vec3<float>* positions, orca::vec3<float>* normals)
+{
+    if(workers.empty() == true)
+    {
+        SkinVertices(vertices, count, joint_matrices, positions, normals);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job_vertices = vertices;
+        job_count = count;
+        job_joint_matrices = joint_matrices;
+        job_positions = positions;
+        job_normals = normals;
+        num_pending = static_cast<unsigned int>(workers.size());
+        ++generation;
+    }
+    start_condition.notify_all();
+
+    SkinRange(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done_condition.wait(lock, [this]() { return num_pending == 0; });
+}
+
+/* function to skin the vertices with the joint palette into the output vectors */
+void CpuSkinning::Skin(const std::vector<Vertex>& vertices, const orca::affine<float>* joint_matrices, std::vector<orca::vec3<float>>& positions, std::vector<orca::vec3<float>>& normals)
+{
+    positions.resize(vertices.size());
+    normals.resize(vertices.size());
+    Skin(vertices.data(), vertices.size(), joint_matrices, positions.data(), normals.data());
+}
+
+unsigned int CpuSkinning::NumThreads() const
+{
+    return static_cast<unsigned int>(workers.size()) + 1;
+}
+
+/* function that waits for a job and skins the range of the thread */
+void CpuSkinning::WorkerLoop(unsigned int thread_id)
+{
+    unsigned long long seen_generation = 0;
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            start_condition.wait(lock, [&]() { return stop || generation != seen_generation; });
+            if(stop == true)
+                return;
+            seen_generation = generation;
+        }
+
+        SkinRange(thread_id);
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            last = (--num_pending == 0);
+        }
+        if(last == true)
+            done_condition.notify_one();
+    }
+}
+
+/* function to skin the part of the current job that belongs to the thread  */
+/* NOTE: ranges are multiples of 8 vertices so that only the last one has a */
+/*       scalar tail                                                         */
+void CpuSkinning::SkinRange(unsigned int thread_id)
+{
+    const std::size_t num_blocks = (job_count + 7) / 8;
+    const std::size_t begin = std::min(job_count, num_blocks * thread_id / NumThreads() * 8);
+    const std::size_t end = std::min(job_count, num_blocks * (thread_id + 1) / NumThreads() * 8);
+    if(begin < end)
+        SkinVertices(job_vertices + begin, end - begin, job_joint_matrices, job_positions + begin, job_normals + begin);
+}
\ No newline at end of file
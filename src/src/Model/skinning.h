@@ -0,0 +1,62 @@
+/***************************/
+/*  FILE NAME: skinning.h  */
+/***************************/
+#ifndef _SKINNING_H_
+#define _SKINNING_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <condition_variable>
+#include <vector.hpp>
+#include <matrix.hpp>
+#include "vertex.h"
+
+/*****************************/
+/*  CLASS NAME: CpuSkinning  */
+/*****************************/
+/* linear blend skinning on the CPU, same result as GLSL/anim_vert.glsl.  */
+/* the vertices are split into one range per thread; the calling thread   */
+/* skins the first range while the worker threads skin the others.        */
+class CpuSkinning
+{
+public:
+    CpuSkinning();
+    explicit CpuSkinning(unsigned int num_threads);
+    CpuSkinning(const CpuSkinning& other) = delete;
+    ~CpuSkinning();
+
+public:
+    CpuSkinning& operator=(const CpuSkinning& rhs) = delete;
+
+public:
+    void Skin(const Vertex* vertices, std::size_t count, const orca::affine<float>* joint_matrices, orca::vec3<float>* positions, orca::vec3<float>* normals);
+    void Skin(const std::vector<Vertex>& vertices, const orca::affine<float>* joint_matrices, std::vector<orca::vec3<float>>& positions, std::vector<orca::vec3<float>>& normals);
+    unsigned int NumThreads() const;
+
+private:
+    void WorkerLoop(unsigned int thread_id);
+    void SkinRange(unsigned int thread_id);
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable start_condition;
+    std::condition_variable done_condition;
+    unsigned long long generation;
+    unsigned int num_pending;
+    bool stop;
+
+    const Vertex* job_vertices;
+    std::size_t job_count;
+    const orca::affine<float>* job_joint_matrices;
+    orca::vec3<float>* job_positions;
+    orca::vec3<float>* job_normals;
+}; // class CpuSkinning
+
+void SkinVertices(const Vertex* vertices, std::size_t count, const orca::affine<float>* joint_matrices, orca::vec3<float>* positions, orca::vec3<float>* normals);
+#endif // !_SKINNING_H_
\ No newline at end of file
@@ -6,83 +6,81 @@
 /**************/
 /*  INCLUDES  */
 /**************/
-#include <stdexcept>
-#include <GL/glew.h>
-
-/*********************/
-/*  STATIC VARIABLE  */
-/*********************/
-static constexpr int Wrap_Mode[] = 
-{
-    0,     // UNKNOWN
-    10497, // REPEAT
-    33069, // CLAMP_TO_BORDER,
-    33071, // CLAMP_TO_EDGE
-    33648  // GL_MIRRORED_REPEAT
-};
-
-static constexpr int Filter_Mode[] = 
-{
-    0,    // UNKNOWN
-    9728, // NEAREST
-    9729, // LINEAR
-    9984, // NEAREST_MIPMAP_NEAREST
-    9985, // LINEAR_MIPMAP_NEAREST
-    9986, // NEAREST_MIPMAP_LINEAR
-    9987  // LINEAR_MIPMAP_LINEAR
-};
+#include <utility>
+#include <algorithm>
 
 /* default constructor */
 Texture::Texture()
     : name()
     , image()
     , sampler()
+    , srgb(false)
+    , mip_chain()
     , tbo()
+    , num_levels(0)
+    , base_level(0)
 { /* empty */ }
 
-/* copy constructor */
-Texture::Texture(const Texture& other)
-    : name(other.name)
-    , image(other.image)
+/* move constructor */
+/* (the texture object is taken from 'other', its mip chain points into */
+/*  the image of 'other' and is not moved, build it again if needed)    */
+Texture::Texture(Texture&& other) noexcept
+    : name(std::move(other.name))
+    , image(std::move(other.image))
     , sampler(other.sampler)
-    , tbo(other.tbo)
+    , srgb(other.srgb)
+    , mip_chain()
+    , tbo(std::exchange(other.tbo, 0U))
+    , num_levels(other.num_levels)
+    , base_level(other.base_level)
 { /* empty */ }
 
-/* function to make texture data available to OpenGL */
-void Texture::SetupTexture()
+/* move assignment operator */
+/* (the texture objects are swapped, 'rhs' cleans up the old one. neither */
+/*  keeps its mip chain, the image of 'rhs' is gone)                      */
+Texture& Texture::operator=(Texture&& rhs) noexcept
 {
-    glGenTextures(1, &tbo);
-    glBindTexture(GL_TEXTURE_2D, tbo);
-    
-    GLenum format;
-    if(image.component == 1)
-        format = GL_RED;
-    else if(image.component == 3)
-        format = GL_RGB;
-    else if(image.component == 4)
-        format = GL_RGBA;
-    else throw std::runtime_error("Undefined Texture image format.");
+    if(this == &rhs)
+        return *this;
 
-    glTexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.data.data());
-    glGenerateMipmap(GL_TEXTURE_2D);
+    name = std::move(rhs.name);
+    image = std::move(rhs.image);
+    sampler = rhs.sampler;
+    srgb = rhs.srgb;
+    mip_chain.Clear();
+    rhs.mip_chain.Clear();
+    std::swap(tbo, rhs.tbo);
+    std::swap(num_levels, rhs.num_levels);
+    std::swap(base_level, rhs.base_level);
+    return *this;
+}
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, Wrap_Mode[static_cast<int>(sampler.wrap_R)]);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, Wrap_Mode[static_cast<int>(sampler.wrap_S)]);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, Wrap_Mode[static_cast<int>(sampler.wrap_T)]);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, Filter_Mode[static_cast<int>(sampler.min_filter)]);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, Filter_Mode[static_cast<int>(sampler.mag_filter)]);
+/* function to return the OpenGL texture object */
+unsigned int Texture::GetTexture() const
+{
+    return tbo;
+}
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+int Texture::NumLevels() const
+{
+    return num_levels;
 }
 
-/* function to clean up texture data used in OpenGL */
-void Texture::CleanupTexture()
+/* function to return the finest level sampled so far */
+int Texture::GetBaseLevel() const
 {
-    glDeleteTextures(1, &tbo);
+    return base_level;
 }
 
-/* function to bind OpenGL texture */
-void Texture::BindTexture()
+/* function to return the bytes of the storage of every level (0 before SetupTexture()) */
+std::size_t Texture::GpuBytes() const
 {
-    glBindTexture(GL_TEXTURE_2D, tbo);
+    std::size_t bytes = 0;
+    for(int level = 0; level < num_levels; ++level)
+    {
+        const std::size_t width = static_cast<std::size_t>(std::max(image.width >> level, 1));
+        const std::size_t height = static_cast<std::size_t>(std::max(image.height >> level, 1));
+        bytes += width * height * static_cast<std::size_t>(image.component);
+    }
+    return bytes;
 }
\ No newline at end of file
@@ -8,29 +8,52 @@
 /*  INCLUDES  */
 /**************/
 #include <string>
+#include <cstddef>
 #include "image.h"
+#include "mip_chain.h"
 #include "texture_sampler.h"
 
 /*************************/
 /*  CLASS NAME: Texture  */
 /*************************/
+/* immutable storage for every mip level. SetupTexture() only allocates it  */
+/* and fills the 1x1 level with white, the levels are then streamed in from */
+/* the mip chain (TextureStreamer) and the base level lowered as they land. */
+/* move-only: it owns its texture object.                                   */
 class Texture
 {
 public:
     Texture();
-    Texture(const Texture& other);
+    Texture(const Texture& other) = delete;
+    Texture(Texture&& other) noexcept;
+
+public:
+    Texture& operator=(const Texture& rhs) = delete;
+    Texture& operator=(Texture&& rhs) noexcept;
 
 public:
     void SetupTexture();
     void CleanupTexture();
     void BindTexture();
+    void UploadRows(int level, int first_row, int num_rows, std::size_t offset);
+    void SetBaseLevel(int level);
+
+public:
+    unsigned int GetTexture() const;
+    int NumLevels() const;
+    int GetBaseLevel() const;
+    std::size_t GpuBytes() const;
 
 public:
     std::string name;
     Image image;
     TextureSampler sampler;
+    bool srgb;              /* color data, mips are averaged in linear light */
+    MipChain mip_chain;     /* built by a worker thread, cleared once uploaded */
 
 private:
     unsigned int tbo;
+    int num_levels;
+    int base_level;
 }; // class name Texture
 #endif // !_TEXTURE_H_
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*******************************/
+/*  FILE NAME: texture_gl.cpp  */
+/*******************************/
+#include "texture.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <algorithm>
+#include <stdexcept>
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+#include "Profiler/profiler.h"
+
+/*********************/
+/*  STATIC VARIABLE  */
+/*********************/
+static constexpr int Wrap_Mode[] = 
+{
+    0,     // UNKNOWN
+    10497, // REPEAT
+    33069, // CLAMP_TO_BORDER,
+    33071, // CLAMP_TO_EDGE
+    33648  // GL_MIRRORED_REPEAT
+};
+
+static constexpr int Filter_Mode[] = 
+{
+    0,    // UNKNOWN
+    9728, // NEAREST
+    9729, // LINEAR
+    9984, // NEAREST_MIPMAP_NEAREST
+    9985, // LINEAR_MIPMAP_NEAREST
+    9986, // NEAREST_MIPMAP_LINEAR
+    9987  // LINEAR_MIPMAP_LINEAR
+};
+
+/* function to return the pixel format of an image with 'component' channels */
+static GLenum PixelFormat(int component)
+{
+    if(component == 1)
+        return GL_RED;
+    else if(component == 3)
+        return GL_RGB;
+    else if(component == 4)
+        return GL_RGBA;
+    else throw std::runtime_error("Undefined Texture image format.");
+}
+
+/* function to return the sized internal format of an image with 'component' channels */
+static GLenum InternalFormat(int component)
+{
+    if(component == 1)
+        return GL_R8;
+    else if(component == 3)
+        return GL_RGB8;
+    else
+        return GL_RGBA8;
+}
+
+/* function to allocate the texture, sampled as white until the levels are streamed */
+void Texture::SetupTexture()
+{
+    PROFILE_ZONE("Texture::SetupTexture", "load");
+    glGenTextures(1, &tbo);
+    GLState::Get().BindTexture(GL_TEXTURE_2D, tbo);
+    
+    const GLenum format = PixelFormat(image.component);
+    num_levels = NumMipLevels(image.width, image.height);
+
+    /* NOTE: immutable storage needs GL 4.2 or ARB_texture_storage, else each level is allocated once */
+    if(GLEW_VERSION_4_2 || GLEW_ARB_texture_storage)
+        glTexStorage2D(GL_TEXTURE_2D, num_levels, InternalFormat(image.component), image.width, image.height);
+    else
+    {
+        for(int level = 0; level < num_levels; ++level)
+            glTexImage2D(GL_TEXTURE_2D, level, InternalFormat(image.component), std::max(image.width >> level, 1), std::max(image.height >> level, 1), 0, format, GL_UNSIGNED_BYTE, nullptr);
+    }
+
+    const unsigned char white[4] = { 255, 255, 255, 255 };
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, num_levels - 1, 0, 0, 1, 1, format, GL_UNSIGNED_BYTE, white);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, num_levels - 1);
+    SetBaseLevel(num_levels - 1);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, Wrap_Mode[static_cast<int>(sampler.wrap_R)]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, Wrap_Mode[static_cast<int>(sampler.wrap_S)]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, Wrap_Mode[static_cast<int>(sampler.wrap_T)]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, Filter_Mode[static_cast<int>(sampler.min_filter)]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, Filter_Mode[static_cast<int>(sampler.mag_filter)]);
+}
+
+/* function to clean up texture data used in OpenGL */
+void Texture::CleanupTexture()
+{
+    GLState::Get().DeleteTexture(tbo);
+}
+
+/* function to bind OpenGL texture */
+void Texture::BindTexture()
+{
+    GLState::Get().BindTexture(GL_TEXTURE_2D, tbo);
+}
+
+/* function to copy rows of a level from the bound pixel unpack buffer at 'offset' */
+void Texture::UploadRows(int level, int first_row, int num_rows, std::size_t offset)
+{
+    GLState::Get().BindTexture(GL_TEXTURE_2D, tbo);
+    glTexSubImage2D(GL_TEXTURE_2D, level, 0, first_row, std::max(image.width >> level, 1), num_rows,
+                    PixelFormat(image.component), GL_UNSIGNED_BYTE, reinterpret_cast<void*>(offset));
+}
+
+/* function to sample the texture from 'level' down, once that level is complete */
+void Texture::SetBaseLevel(int level)
+{
+    GLState::Get().BindTexture(GL_TEXTURE_2D, tbo);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level);
+    base_level = level;
+}
\ No newline at end of file
@@ -44,6 +44,9 @@ public:
     TextureSampler();
     TextureSampler(const TextureSampler& other);
 
+public:
+    TextureSampler& operator=(const TextureSampler& rhs) = default;
+
 public:
     std::string name;
     FILTER_MODE min_filter;
@@ -0,0 +1,215 @@
+/*************************************/
+/*  FILE NAME: texture_streamer.cpp  */
+/*************************************/
+#include "texture_streamer.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstring>
+#include <algorithm>
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+#include "Profiler/profiler.h"
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+/* alignment of the rows copied into the upload ring */
+static constexpr std::size_t ROW_ALIGNMENT = 4;
+
+/* default constructor */
+TextureUpload::TextureUpload()
+    : texture(nullptr)
+    , level(0)
+    , row(0)
+{ /* empty */ }
+
+/* copy constructor */
+TextureUpload::TextureUpload(const TextureUpload& other)
+    : texture(other.texture)
+    , level(other.level)
+    , row(other.row)
+{ /* empty */ }
+
+
+/* default constructor */
+TextureStreamer::TextureStreamer()
+    : workers()
+    , mutex()
+    , jobs()
+    , built()
+    , stop(false)
+    , uploads()
+    , num_remaining(0)
+    , chain_bytes(0)
+{ /* empty */ }
+
+/* destructor */
+TextureStreamer::~TextureStreamer()
+{
+    Stop();
+}
+
+/* function to start building the mip chains of 'textures' (set up already)   */
+/* NOTE: the textures must stay where they are until IsDone() or Stop()        */
+void TextureStreamer::Start(std::map<int, Texture>& textures)
+{
+    Stop();
+
+    for(auto& texture : textures)
+        jobs.push_back(&texture.second);
+    num_remaining = jobs.size();
+
+    /* the largest images first, so one of them does not finish last on its own */
+    std::sort(jobs.begin(), jobs.end(), [](const Texture* a, const Texture* b)
+    {
+        return a->image.data.size() > b->image.data.size();
+    });
+
+    const std::size_t num_threads = std::min<std::size_t>(std::max(1U, std::thread::hardware_concurrency()), jobs.size());
+    for(std::size_t i = 0; i < num_threads; ++i)
+        workers.emplace_back(&TextureStreamer::WorkerLoop, this);
+}
+
+/* function to stop the workers after the chains they are building   */
+/* (the textures keep the levels streamed so far)                    */
+void TextureStreamer::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    for(auto& worker : workers)
+        worker.join();
+
+    workers.clear();
+    jobs.clear();
+    built.clear();
+    uploads.clear();
+    num_remaining = 0;
+    chain_bytes = 0;
+    stop = false;
+}
+
+/* function to stream up to 'budget' bytes of levels, returns the bytes streamed  */
+/* NOTE: a row wider than the budget is streamed alone. the budget has to fit in */
+/*       the current region of 'ring' next to the other uploads of the frame.    */
+std::size_t TextureStreamer::Stream(UploadRing& ring, std::size_t budget)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(Texture* texture : built)
+        {
+            TextureUpload upload;
+            upload.texture = texture;
+            upload.level = texture->mip_chain.NumLevels() - 1;
+            uploads.push_back(upload);
+            chain_bytes += texture->mip_chain.Bytes();
+        }
+        built.clear();
+    }
+    if(uploads.empty() == true)
+        return 0;
+
+    GLState& state = GLState::Get();
+    state.BindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.GetBuffer());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    std::size_t streamed = 0;
+    while(uploads.empty() == false)
+    {
+        /* NOTE: checked first, a row streamed alone or a partial level may leave it exceeded */
+        if(streamed > 0 && streamed >= budget)
+            break;
+
+        auto upload = std::max_element(uploads.begin(), uploads.end(), [](const TextureUpload& a, const TextureUpload& b)
+        {
+            return a.level < b.level;
+        });
+        Texture& texture = *upload->texture;
+        const MipChain& chain = texture.mip_chain;
+
+        const std::size_t row_bytes = chain.RowBytes(upload->level);
+        const int rows_left = chain.Height(upload->level) - upload->row;
+        int num_rows = static_cast<int>(std::min<std::size_t>(rows_left, (budget - streamed) / row_bytes));
+        if(num_rows == 0)
+        {
+            if(streamed > 0)
+                break;
+            num_rows = 1;
+        }
+
+        const std::size_t bytes = row_bytes * num_rows;
+        const UploadAllocation allocation = ring.Allocate(bytes, ROW_ALIGNMENT);
+        std::memcpy(allocation.data, chain.Data(upload->level) + row_bytes * upload->row, bytes);
+        ring.Flush();
+        texture.UploadRows(upload->level, upload->row, num_rows, allocation.offset);
+        streamed += bytes;
+
+        upload->row += num_rows;
+        if(upload->row < chain.Height(upload->level))
+            continue;
+
+        /* the level is complete, sample it and go on with the next finer one */
+        texture.SetBaseLevel(upload->level);
+        upload->level -= 1;
+        upload->row = 0;
+        if(upload->level < 0)
+        {
+            chain_bytes -= texture.mip_chain.Bytes();
+            texture.mip_chain.Clear();
+            std::vector<unsigned char>().swap(texture.image.data);
+            uploads.erase(upload);
+            num_remaining -= 1;
+        }
+    }
+
+    /* NOTE: client memory uploads (SetupTexture()) expect no unpack buffer */
+    state.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return streamed;
+}
+
+/* function to return true once every texture is fully uploaded */
+bool TextureStreamer::IsDone() const
+{
+    return (num_remaining == 0);
+}
+
+/* function to return the number of textures not fully uploaded */
+std::size_t TextureStreamer::NumRemaining() const
+{
+    return num_remaining;
+}
+
+/* function to return the bytes of the mip levels built and not fully uploaded yet */
+/* (the chains still being built by the workers are not counted)                   */
+std::size_t TextureStreamer::ChainBytes() const
+{
+    return chain_bytes;
+}
+
+/* function that builds the mip chains of the queued textures until none is left */
+void TextureStreamer::WorkerLoop()
+{
+    Profiler::Get().SetThreadName("texture worker");
+    while(true)
+    {
+        Texture* texture = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(stop == true || jobs.empty() == true)
+                return;
+            texture = jobs.front();
+            jobs.pop_front();
+        }
+
+        {
+            PROFILE_ZONE("MipChain::Build", "load");
+            texture->mip_chain.Build(texture->image, texture->srgb);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        built.push_back(texture);
+    }
+}
\ No newline at end of file
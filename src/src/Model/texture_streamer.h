@@ -0,0 +1,77 @@
+/***********************************/
+/*  FILE NAME: texture_streamer.h  */
+/***********************************/
+#ifndef _TEXTURE_STREAMER_H_
+#define _TEXTURE_STREAMER_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <map>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include "texture.h"
+#include "Renderer/upload_ring.h"
+
+/*******************************/
+/*  CLASS NAME: TextureUpload  */
+/*******************************/
+/* next rows of a texture to stream, the levels go from the coarsest to level 0 */
+class TextureUpload
+{
+public:
+    TextureUpload();
+    TextureUpload(const TextureUpload& other);
+
+public:
+    Texture* texture;
+    int level;
+    int row;
+}; // class TextureUpload
+
+/*********************************/
+/*  CLASS NAME: TextureStreamer  */
+/*********************************/
+/* fills the textures of a model after SetupTexture(). worker threads build */
+/* the mip chains (gamma-correct for color textures), and Stream() copies a */
+/* budget of rows a frame into the upload ring, bound as the pixel unpack    */
+/* buffer, and from there into the textures. the coarsest pending level of  */
+/* all textures goes first, so every texture sharpens level by level.       */
+class TextureStreamer
+{
+public:
+    TextureStreamer();
+    TextureStreamer(const TextureStreamer& other) = delete;
+    ~TextureStreamer();
+
+public:
+    TextureStreamer& operator=(const TextureStreamer& rhs) = delete;
+
+public:
+    void Start(std::map<int, Texture>& textures);
+    void Stop();
+    std::size_t Stream(UploadRing& ring, std::size_t budget);
+
+public:
+    bool IsDone() const;
+    std::size_t NumRemaining() const;
+    std::size_t ChainBytes() const;
+
+private:
+    void WorkerLoop();
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::deque<Texture*> jobs;      /* textures without a mip chain, taken by the workers */
+    std::vector<Texture*> built;    /* mip chains done, taken by Stream()                  */
+    bool stop;
+
+    std::vector<TextureUpload> uploads; /* main thread only */
+    std::size_t num_remaining;          /* textures not fully uploaded */
+    std::size_t chain_bytes;            /* mip levels held by 'uploads' */
+}; // class TextureStreamer
+#endif // !_TEXTURE_STREAMER_H_
\ No newline at end of file
@@ -0,0 +1,203 @@
+/**********************************/
+/*  FILE NAME: alloc_tracker.cpp  */
+/**********************************/
+#include "alloc_tracker.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <new>
+#include <string>
+#include <cstdlib>
+#include <stdexcept>
+
+/*********************/
+/*  STATIC VARIABLE  */
+/*********************/
+/* NOTE: plain counters, constant initialized, so operator new never runs a thread local constructor */
+static thread_local std::size_t thread_allocations = 0;
+static thread_local std::size_t thread_frees = 0;
+static thread_local std::size_t thread_bytes = 0;
+
+/* default constructor */
+AllocationCounts::AllocationCounts()
+    : allocations(0)
+    , frees(0)
+    , bytes(0)
+{ /* empty */ }
+
+/* copy constructor */
+AllocationCounts::AllocationCounts(const AllocationCounts& other)
+    : allocations(other.allocations)
+    , frees(other.frees)
+    , bytes(other.bytes)
+{ /* empty */ }
+
+
+/* function to return whether the operators count the allocations */
+bool AllocationTracker::IsEnabled()
+{
+#ifdef GLTF_ANIMATION_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/* function to return the allocations of the calling thread since it started */
+AllocationCounts AllocationTracker::ThreadCounts()
+{
+    AllocationCounts counts;
+    counts.allocations = thread_allocations;
+    counts.frees = thread_frees;
+    counts.bytes = thread_bytes;
+    return counts;
+}
+
+
+/* constructor */
+AllocationScope::AllocationScope()
+    : start(AllocationTracker::ThreadCounts())
+{ /* empty */ }
+
+/* function to count from now on */
+void AllocationScope::Restart()
+{
+    start = AllocationTracker::ThreadCounts();
+}
+
+/* function to return the allocations of the calling thread since the scope started */
+AllocationCounts AllocationScope::Counts() const
+{
+    const AllocationCounts now = AllocationTracker::ThreadCounts();
+    AllocationCounts counts;
+    counts.allocations = now.allocations - start.allocations;
+    counts.frees = now.frees - start.frees;
+    counts.bytes = now.bytes - start.bytes;
+    return counts;
+}
+
+/* function to throw if 'what' (the work of the scope) allocated */
+void AllocationScope::ExpectNone(const char* what) const
+{
+    const AllocationCounts counts = Counts();
+    if(counts.allocations > 0)
+    {
+        throw std::runtime_error(std::string(what) + " allocated " + std::to_string(counts.allocations) + " time(s) ("
+                                 + std::to_string(counts.bytes) + " bytes)");
+    }
+}
+
+
+#ifdef GLTF_ANIMATION_TRACK_ALLOCATIONS
+/* function to count an allocation and make it, like the standard operator new */
+static void* CountedAllocate(std::size_t size)
+{
+    thread_allocations += 1;
+    thread_bytes += size;
+
+    if(size == 0)
+        size = 1;
+    while(true)
+    {
+        void* pointer = std::malloc(size);
+        if(pointer != nullptr)
+            return pointer;
+
+        std::new_handler handler = std::get_new_handler();
+        if(handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+/* function to count an allocation aligned to more than the default and make it */
+static void* CountedAllocateAligned(std::size_t size, std::align_val_t alignment)
+{
+    thread_allocations += 1;
+    thread_bytes += size;
+
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if(size == 0)
+        size = 1;
+    while(true)
+    {
+#ifdef _WIN32
+        void* pointer = _aligned_malloc(size, align);
+#else
+        void* pointer = nullptr;
+        if(posix_memalign(&pointer, align, size) != 0)
+            pointer = nullptr;
+#endif
+        if(pointer != nullptr)
+            return pointer;
+
+        std::new_handler handler = std::get_new_handler();
+        if(handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+static void CountedFree(void* pointer)
+{
+    if(pointer == nullptr)
+        return;
+    thread_frees += 1;
+    std::free(pointer);
+}
+
+static void CountedFreeAligned(void* pointer)
+{
+    if(pointer == nullptr)
+        return;
+    thread_frees += 1;
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+/**************************************/
+/*  REPLACEABLE ALLOCATION FUNCTIONS  */
+/**************************************/
+void* operator new(std::size_t size) { return CountedAllocate(size); }
+void* operator new[](std::size_t size) { return CountedAllocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return CountedAllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return CountedAllocateAligned(size, alignment); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try { return CountedAllocate(size); }
+    catch(...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try { return CountedAllocate(size); }
+    catch(...) { return nullptr; }
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try { return CountedAllocateAligned(size, alignment); }
+    catch(...) { return nullptr; }
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try { return CountedAllocateAligned(size, alignment); }
+    catch(...) { return nullptr; }
+}
+
+void operator delete(void* pointer) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { CountedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { CountedFreeAligned(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { CountedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { CountedFreeAligned(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { CountedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { CountedFreeAligned(pointer); }
+#endif
\ No newline at end of file
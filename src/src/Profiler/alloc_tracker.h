@@ -0,0 +1,69 @@
+/********************************/
+/*  FILE NAME: alloc_tracker.h  */
+/********************************/
+#ifndef _ALLOC_TRACKER_H_
+#define _ALLOC_TRACKER_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstddef>
+
+/**********************************/
+/*  CLASS NAME: AllocationCounts  */
+/**********************************/
+/* heap allocations and frees of a thread, and the bytes allocated */
+class AllocationCounts
+{
+public:
+    AllocationCounts();
+    AllocationCounts(const AllocationCounts& other);
+
+public:
+    AllocationCounts& operator=(const AllocationCounts& rhs) = default;
+
+public:
+    std::size_t allocations;
+    std::size_t frees;
+    std::size_t bytes;
+}; // class AllocationCounts
+
+/***********************************/
+/*  CLASS NAME: AllocationTracker  */
+/***********************************/
+/* counts the heap allocations of each thread through the global operator   */
+/* new and delete, replaced in alloc_tracker.cpp. without                   */
+/* GLTF_ANIMATION_TRACK_ALLOCATIONS (CMake option                           */
+/* GLTF_ANIMATION_ALLOCATION_TRACKER) the standard operators are used and   */
+/* nothing is counted. a count costs a thread local increment.              */
+class AllocationTracker
+{
+public:
+    AllocationTracker() = delete;
+
+public:
+    static bool IsEnabled();
+    static AllocationCounts ThreadCounts();
+}; // class AllocationTracker
+
+/*********************************/
+/*  CLASS NAME: AllocationScope  */
+/*********************************/
+/* the allocations of the calling thread since the scope was made (or     */
+/* restarted). scopes may nest, each one counts everything made in it.    */
+class AllocationScope
+{
+public:
+    AllocationScope();
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+public:
+    void Restart();
+    AllocationCounts Counts() const;
+    void ExpectNone(const char* what) const;
+
+private:
+    AllocationCounts start;
+}; // class AllocationScope
+#endif // !_ALLOC_TRACKER_H_
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*****************************/
+/*  FILE NAME: profiler.cpp  */
+/*****************************/
+#include "profiler.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstdio>
+#include <stdexcept>
+
+/* default constructor */
+ProfileEvent::ProfileEvent()
+    : name("")
+    , category("")
+    , start(0.0)
+    , duration(0.0)
+{ /* empty */ }
+
+/* copy constructor */
+ProfileEvent::ProfileEvent(const ProfileEvent& other)
+    : name(other.name)
+    , category(other.category)
+    , start(other.start)
+    , duration(other.duration)
+{ /* empty */ }
+
+
+/* default constructor */
+ProfileThread::ProfileThread()
+    : id(0)
+    , name()
+    , mutex()
+    , events()
+{ /* empty */ }
+
+/* copy constructor */
+ProfileThread::ProfileThread(const ProfileThread& other)
+    : id(other.id)
+    , name(other.name)
+    , mutex()
+    , events(other.events)
+{ /* empty */ }
+
+
+/* constructor */
+Profiler::Profiler()
+    : capturing(false)
+    , num_events(0)
+    , num_dropped(0)
+    , max_events(DEFAULT_MAX_EVENTS)
+    , epoch(std::chrono::steady_clock::now())
+    , mutex()
+    , threads()
+{
+    threads.push_back(std::make_unique<ProfileThread>());
+    threads.back()->name = "GPU";
+}
+
+/* function to return the profiler of the process */
+Profiler& Profiler::Get()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+/* function to return whether the zones were compiled in */
+bool Profiler::HasZones()
+{
+#ifdef GLTF_ANIMATION_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+/* function to drop the events of the last capture and start a new one */
+void Profiler::Start()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for(auto& thread : threads)
+    {
+        std::lock_guard<std::mutex> thread_lock(thread->mutex);
+        thread->events.clear();
+    }
+    num_events = 0;
+    num_dropped = 0;
+    capturing.store(true, std::memory_order_relaxed);
+}
+
+/* function to stop recording, the events are kept until the next Start() */
+void Profiler::Stop()
+{
+    capturing.store(false, std::memory_order_relaxed);
+}
+
+/* function to name the track of the calling thread in the trace */
+void Profiler::SetThreadName(const std::string& name)
+{
+    ProfileThread& thread = GetThread();
+    std::lock_guard<std::mutex> lock(thread.mutex);
+    thread.name = name;
+}
+
+/* function to set how many events a capture holds, the ones after are dropped */
+void Profiler::SetMaxEvents(std::size_t count)
+{
+    max_events = count;
+}
+
+/* function to return the microseconds since the profiler was made */
+double Profiler::Now() const
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+/* function to record a zone of the calling thread */
+void Profiler::Record(const char* name, const char* category, double start, double end)
+{
+    Append(GetThread(), name, category, start, end);
+}
+
+/* function to record a zone of the GPU, with its times already mapped to Now() */
+void Profiler::RecordGpu(const char* name, double start, double end)
+{
+    Append(*threads.front(), name, "gpu", start, end);
+}
+
+/* function to write the events of the last capture as a Chrome trace (JSON object format) */
+void Profiler::WriteTrace(const std::string& file) const
+{
+    std::FILE* output = std::fopen(file.c_str(), "w");
+    if(output == nullptr)
+        throw std::runtime_error("Failed to open '" + file + "'");
+
+    std::fprintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    std::lock_guard<std::mutex> lock(mutex);
+    for(const auto& thread : threads)
+    {
+        std::lock_guard<std::mutex> thread_lock(thread->mutex);
+        if(thread->events.empty())
+            continue;
+
+        /* NOTE: the names are string literals and thread names of this program, none needs escaping */
+        std::fprintf(output, "%s{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":\"%s\"}}",
+                     first ? "" : ",\n", thread->id, thread->name.c_str());
+        std::fprintf(output, ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%u}}",
+                     thread->id, thread->id);
+        first = false;
+        for(const auto& event : thread->events)
+        {
+            std::fprintf(output, ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"name\":\"%s\",\"cat\":\"%s\",\"ts\":%.3f,\"dur\":%.3f}",
+                         thread->id, event.name, event.category, event.start, event.duration);
+        }
+    }
+    std::fprintf(output, "\n]}\n");
+
+    const bool failed = (std::ferror(output) != 0);
+    std::fclose(output);
+    if(failed)
+        throw std::runtime_error("Failed to write '" + file + "'");
+}
+
+/* function to return the number of events recorded by the last capture */
+std::size_t Profiler::NumEvents() const
+{
+    return num_events;
+}
+
+/* function to return the number of events dropped once the capture was full */
+std::size_t Profiler::NumDropped() const
+{
+    return num_dropped;
+}
+
+/* function to return the track of the calling thread, made on its first zone */
+ProfileThread& Profiler::GetThread()
+{
+    thread_local ProfileThread* current = nullptr;
+    if(current == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.push_back(std::make_unique<ProfileThread>());
+        current = threads.back().get();
+        current->id = static_cast<std::uint32_t>(threads.size() - 1);
+        current->name = "thread " + std::to_string(current->id);
+    }
+    return *current;
+}
+
+/* function to append an event to 'thread', or drop it if the capture is full */
+void Profiler::Append(ProfileThread& thread, const char* name, const char* category, double start, double end)
+{
+    if(num_events.fetch_add(1, std::memory_order_relaxed) >= max_events)
+    {
+        num_events.fetch_sub(1, std::memory_order_relaxed);
+        num_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ProfileEvent event;
+    event.name = name;
+    event.category = category;
+    event.start = start;
+    event.duration = end - start;
+
+    std::lock_guard<std::mutex> lock(thread.mutex);
+    thread.events.push_back(event);
+}
\ No newline at end of file
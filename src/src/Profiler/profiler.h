@@ -0,0 +1,147 @@
+/***************************/
+/*  FILE NAME: profiler.h  */
+/***************************/
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/***************************/
+/*  MACROS: PROFILE_ZONE   */
+/***************************/
+/* times the rest of the enclosing scope as 'name' (a string literal) of */
+/* 'category'. without GLTF_ANIMATION_PROFILE (CMake option              */
+/* GLTF_ANIMATION_PROFILER) a zone is compiled out entirely.             */
+#ifdef GLTF_ANIMATION_PROFILE
+    #define PROFILE_CONCAT_IMPL(a, b) a##b
+    #define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+    #define PROFILE_ZONE(name, category) ProfileZone PROFILE_CONCAT(profile_zone_, __LINE__)(name, category)
+#else
+    #define PROFILE_ZONE(name, category) ((void)0)
+#endif
+
+/******************************/
+/*  CLASS NAME: ProfileEvent  */
+/******************************/
+/* a timed zone, in microseconds since the start of the profiler */
+class ProfileEvent
+{
+public:
+    ProfileEvent();
+    ProfileEvent(const ProfileEvent& other);
+
+public:
+    const char* name;
+    const char* category;
+    double start;
+    double duration;
+}; // class ProfileEvent
+
+/*******************************/
+/*  CLASS NAME: ProfileThread  */
+/*******************************/
+/* the events of one thread (a track of the trace). only its thread appends */
+/* to it, the mutex is uncontended unless a trace is written meanwhile.     */
+class ProfileThread
+{
+public:
+    ProfileThread();
+    ProfileThread(const ProfileThread& other);
+
+public:
+    std::uint32_t id;
+    std::string name;
+    std::mutex mutex;
+    std::vector<ProfileEvent> events;
+}; // class ProfileThread
+
+/**************************/
+/*  CLASS NAME: Profiler  */
+/**************************/
+/* collects the zones of every thread while capturing and writes them as a  */
+/* Chrome trace (chrome://tracing, ui.perfetto.dev). each thread records to  */
+/* its own track, GPU times (GpuTimer) go to a track of their own. when not */
+/* capturing, a zone costs a relaxed atomic load.                            */
+class Profiler
+{
+public:
+    static constexpr std::size_t DEFAULT_MAX_EVENTS = 1U << 21;
+
+private:
+    Profiler();
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+public:
+    static Profiler& Get();
+    static bool HasZones();
+
+public:
+    void Start();
+    void Stop();
+    bool IsCapturing() const { return capturing.load(std::memory_order_relaxed); }
+    void SetThreadName(const std::string& name);
+    void SetMaxEvents(std::size_t count);
+
+public:
+    double Now() const;
+    void Record(const char* name, const char* category, double start, double end);
+    void RecordGpu(const char* name, double start, double end);
+    void WriteTrace(const std::string& file) const;
+
+public:
+    std::size_t NumEvents() const;
+    std::size_t NumDropped() const;
+
+private:
+    ProfileThread& GetThread();
+    void Append(ProfileThread& thread, const char* name, const char* category, double start, double end);
+
+private:
+    std::atomic<bool> capturing;
+    std::atomic<std::size_t> num_events;
+    std::atomic<std::size_t> num_dropped;
+    std::size_t max_events;
+    std::chrono::steady_clock::time_point epoch;
+
+    mutable std::mutex mutex;                       /* guards 'threads', not the events */
+    std::vector<std::unique_ptr<ProfileThread>> threads;   /* [0] is the GPU track */
+}; // class Profiler
+
+/*****************************/
+/*  CLASS NAME: ProfileZone  */
+/*****************************/
+/* records the time from its construction to its destruction, if the */
+/* profiler was capturing when it was made (see PROFILE_ZONE)         */
+class ProfileZone
+{
+public:
+    ProfileZone(const char* name, const char* category)
+        : name(name)
+        , category(category)
+        , start(Profiler::Get().IsCapturing() ? Profiler::Get().Now() : -1.0)
+    { /* empty */ }
+    ~ProfileZone()
+    {
+        if(start >= 0.0)
+            Profiler::Get().Record(name, category, start, Profiler::Get().Now());
+    }
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    const char* category;
+    double start;
+}; // class ProfileZone
+#endif // !_PROFILER_H_
\ No newline at end of file
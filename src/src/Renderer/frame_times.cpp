@@ -0,0 +1,130 @@
+/********************************/
+/*  FILE NAME: frame_times.cpp  */
+/********************************/
+#include "frame_times.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <algorithm>
+
+/* default constructor */
+FrameTimeSummary::FrameTimeSummary()
+    : mean(0.0)
+    , p50(0.0)
+    , p95(0.0)
+    , p99(0.0)
+    , max(0.0)
+{ /* empty */ }
+
+/* copy constructor */
+FrameTimeSummary::FrameTimeSummary(const FrameTimeSummary& other)
+    : mean(other.mean)
+    , p50(other.p50)
+    , p95(other.p95)
+    , p99(other.p99)
+    , max(other.max)
+{ /* empty */ }
+
+
+/* default constructor */
+FrameTimes::FrameTimes()
+    : update_times()
+    , render_times()
+    , latencies()
+{ /* empty */ }
+
+/* copy constructor */
+FrameTimes::FrameTimes(const FrameTimes& other)
+    : update_times(other.update_times)
+    , render_times(other.render_times)
+    , latencies(other.latencies)
+{ /* empty */ }
+
+void FrameTimes::Reserve(std::size_t frames)
+{
+    update_times.reserve(frames);
+    render_times.reserve(frames);
+    latencies.reserve(frames);
+}
+
+void FrameTimes::Clear()
+{
+    update_times.clear();
+    render_times.clear();
+    latencies.clear();
+}
+
+/* function to record the times of a frame, in milliseconds */
+void FrameTimes::Add(double update_time, double render_time, double latency)
+{
+    update_times.push_back(update_time);
+    render_times.push_back(render_time);
+    latencies.push_back(latency);
+}
+
+std::size_t FrameTimes::Size() const
+{
+    return update_times.size();
+}
+
+FrameTimeSummary FrameTimes::Update() const
+{
+    return Summarize(update_times);
+}
+
+FrameTimeSummary FrameTimes::Render() const
+{
+    return Summarize(render_times);
+}
+
+FrameTimeSummary FrameTimes::Latency() const
+{
+    return Summarize(latencies);
+}
+
+/* function to return a table of the statistics, one row per phase */
+std::string FrameTimes::Report() const
+{
+    const FrameTimeSummary summaries[3] = { Update(), Render(), Latency() };
+    const char* names[3] = { "update", "render", "latency" };
+
+    char line[128];
+    std::string report;
+    std::snprintf(line, sizeof(line), "%-8s %9s %9s %9s %9s %9s\n", "[ms]", "mean", "p50", "p95", "p99", "max");
+    report += line;
+    for(int i = 0; i < 3; ++i)
+    {
+        const FrameTimeSummary& s = summaries[i];
+        std::snprintf(line, sizeof(line), "%-8s %9.3f %9.3f %9.3f %9.3f %9.3f\n", names[i], s.mean, s.p50, s.p95, s.p99, s.max);
+        report += line;
+    }
+    return report;
+}
+
+
+/* function to return the statistics of 'times'          */
+/* (percentiles by nearest rank, so they are real frames) */
+FrameTimeSummary Summarize(std::vector<double> times)
+{
+    FrameTimeSummary summary;
+    if(times.empty() == true)
+        return summary;
+
+    std::sort(times.begin(), times.end());
+    auto percentile = [&times](double p)
+    {
+        const std::size_t rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(times.size())));
+        return times[std::min(std::max<std::size_t>(rank, 1), times.size()) - 1];
+    };
+
+    summary.mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
+    summary.p50 = percentile(0.50);
+    summary.p95 = percentile(0.95);
+    summary.p99 = percentile(0.99);
+    summary.max = times.back();
+    return summary;
+}
\ No newline at end of file
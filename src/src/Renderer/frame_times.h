@@ -0,0 +1,62 @@
+/******************************/
+/*  FILE NAME: frame_times.h  */
+/******************************/
+#ifndef _FRAME_TIMES_H_
+#define _FRAME_TIMES_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**********************************/
+/*  CLASS NAME: FrameTimeSummary  */
+/**********************************/
+/* statistics of a series of frame times, in milliseconds */
+class FrameTimeSummary
+{
+public:
+    FrameTimeSummary();
+    FrameTimeSummary(const FrameTimeSummary& other);
+
+public:
+    double mean;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+}; // class FrameTimeSummary
+
+/****************************/
+/*  CLASS NAME: FrameTimes  */
+/****************************/
+/* update time, render time and latency (update start to frame end) of */
+/* every frame of a run                                                 */
+class FrameTimes
+{
+public:
+    FrameTimes();
+    FrameTimes(const FrameTimes& other);
+
+public:
+    void Reserve(std::size_t frames);
+    void Clear();
+    void Add(double update_time, double render_time, double latency);
+
+public:
+    std::size_t Size() const;
+    FrameTimeSummary Update() const;
+    FrameTimeSummary Render() const;
+    FrameTimeSummary Latency() const;
+    std::string Report() const;
+
+private:
+    std::vector<double> update_times;
+    std::vector<double> render_times;
+    std::vector<double> latencies;
+}; // class FrameTimes
+
+FrameTimeSummary Summarize(std::vector<double> times);
+#endif // !_FRAME_TIMES_H_
\ No newline at end of file
@@ -0,0 +1,322 @@
+/*****************************/
+/*  FILE NAME: gl_state.cpp  */
+/*****************************/
+#include "gl_state.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <sstream>
+#include <GL/glew.h>
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+/* cached value of a binding that has to be set before it can be skipped */
+static constexpr unsigned int UNKNOWN = ~0U;
+
+/* default constructor */
+GLStateStats::GLStateStats()
+    : issued()
+    , skipped()
+{ /* empty */ }
+
+/* copy constructor */
+GLStateStats::GLStateStats(const GLStateStats& other)
+    : issued()
+    , skipped()
+{
+    for(int i = 0; i < static_cast<int>(GL_STATE_TYPE::COUNT); ++i)
+    {
+        issued[i] = other.issued[i];
+        skipped[i] = other.skipped[i];
+    }
+}
+
+void GLStateStats::Reset()
+{
+    for(int i = 0; i < static_cast<int>(GL_STATE_TYPE::COUNT); ++i)
+    {
+        issued[i] = 0;
+        skipped[i] = 0;
+    }
+}
+
+/* function to return the number of calls sent to OpenGL */
+unsigned int GLStateStats::Issued() const
+{
+    unsigned int total = 0;
+    for(int i = 0; i < static_cast<int>(GL_STATE_TYPE::COUNT); ++i)
+        total += issued[i];
+    return total;
+}
+
+/* function to return the number of calls left out */
+unsigned int GLStateStats::Skipped() const
+{
+    unsigned int total = 0;
+    for(int i = 0; i < static_cast<int>(GL_STATE_TYPE::COUNT); ++i)
+        total += skipped[i];
+    return total;
+}
+
+
+/* default constructor (every binding unknown) */
+GLState::GLState()
+    : program(UNKNOWN)
+    , vertex_array(UNKNOWN)
+    , active_texture(UNKNOWN)
+    , texture_2d()
+    , texture_buffer()
+    , array_buffer(UNKNOWN)
+    , uniform_buffer(UNKNOWN)
+    , texture_buffer_buffer(UNKNOWN)
+#ifdef DEBUG
+    , validation(true)
+#else
+    , validation(false)
+#endif
+    , stats()
+{
+    Invalidate();
+}
+
+/* function to return the state of the current context */
+/* NOTE: the program uses a single OpenGL context       */
+GLState& GLState::Get()
+{
+    static GLState state;
+    return state;
+}
+
+void GLState::UseProgram(unsigned int program)
+{
+    if(Issue(GL_STATE_TYPE::PROGRAM, &this->program, program, GL_CURRENT_PROGRAM))
+        glUseProgram(program);
+}
+
+void GLState::BindVertexArray(unsigned int vertex_array)
+{
+    if(Issue(GL_STATE_TYPE::VERTEX_ARRAY, &this->vertex_array, vertex_array, GL_VERTEX_ARRAY_BINDING))
+        glBindVertexArray(vertex_array);
+}
+
+/* NOTE: 'unit' is the index of the unit, not GL_TEXTURE0 + index */
+void GLState::ActiveTexture(unsigned int unit)
+{
+    if(unit >= MAX_TEXTURE_UNITS)
+        throw std::runtime_error("class 'GLState' error: texture unit " + std::to_string(unit) + " is not tracked.");
+
+    if(active_texture == unit)
+    {
+        if(validation == true)
+            Check(GL_ACTIVE_TEXTURE, GL_TEXTURE0 + unit);
+        stats.skipped[static_cast<int>(GL_STATE_TYPE::ACTIVE_TEXTURE)] += 1;
+        return;
+    }
+    active_texture = unit;
+    stats.issued[static_cast<int>(GL_STATE_TYPE::ACTIVE_TEXTURE)] += 1;
+    glActiveTexture(GL_TEXTURE0 + unit);
+}
+
+/* binds to the active texture unit */
+void GLState::BindTexture(unsigned int target, unsigned int texture)
+{
+    unsigned int query = 0;
+    unsigned int* cached = TextureBinding(target, &query);
+    if(cached == nullptr || Issue(GL_STATE_TYPE::TEXTURE, cached, texture, query))
+        glBindTexture(target, texture);
+}
+
+void GLState::BindBuffer(unsigned int target, unsigned int buffer)
+{
+    unsigned int query = 0;
+    unsigned int* cached = BufferBinding(target, &query);
+    if(cached == nullptr || Issue(GL_STATE_TYPE::BUFFER, cached, buffer, query))
+        glBindBuffer(target, buffer);
+}
+
+/* NOTE: always issued, it also changes the generic binding of 'target' */
+void GLState::BindBufferBase(unsigned int target, unsigned int index, unsigned int buffer)
+{
+    unsigned int query = 0;
+    unsigned int* cached = BufferBinding(target, &query);
+    if(cached != nullptr)
+        *cached = buffer;
+    stats.issued[static_cast<int>(GL_STATE_TYPE::BUFFER)] += 1;
+    glBindBufferBase(target, index, buffer);
+}
+
+/* NOTE: like BindBufferBase(), it also binds the buffer to the generic 'target' */
+void GLState::BindBufferRange(unsigned int target, unsigned int index, unsigned int buffer, std::size_t offset, std::size_t size)
+{
+    unsigned int query = 0;
+    unsigned int* cached = BufferBinding(target, &query);
+    if(cached != nullptr)
+        *cached = buffer;
+    stats.issued[static_cast<int>(GL_STATE_TYPE::BUFFER)] += 1;
+    glBindBufferRange(target, index, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+}
+
+/* NOTE: a deleted program stays in use until another one is used */
+void GLState::DeleteProgram(unsigned int program)
+{
+    glDeleteProgram(program);
+}
+
+void GLState::DeleteVertexArray(unsigned int vertex_array)
+{
+    if(this->vertex_array == vertex_array)
+        this->vertex_array = 0;
+    glDeleteVertexArrays(1, &vertex_array);
+}
+
+/* NOTE: deleting a texture unbinds it from every unit */
+void GLState::DeleteTexture(unsigned int texture)
+{
+    for(unsigned int i = 0; i < MAX_TEXTURE_UNITS; ++i)
+    {
+        if(texture_2d[i] == texture)
+            texture_2d[i] = 0;
+        if(texture_buffer[i] == texture)
+            texture_buffer[i] = 0;
+    }
+    glDeleteTextures(1, &texture);
+}
+
+void GLState::DeleteBuffer(unsigned int buffer)
+{
+    if(array_buffer == buffer)
+        array_buffer = 0;
+    if(uniform_buffer == buffer)
+        uniform_buffer = 0;
+    if(texture_buffer_buffer == buffer)
+        texture_buffer_buffer = 0;
+    glDeleteBuffers(1, &buffer);
+}
+
+/* function to forget every binding (after code that bypassed the cache) */
+void GLState::Invalidate()
+{
+    program = UNKNOWN;
+    vertex_array = UNKNOWN;
+    active_texture = UNKNOWN;
+    for(unsigned int i = 0; i < MAX_TEXTURE_UNITS; ++i)
+    {
+        texture_2d[i] = UNKNOWN;
+        texture_buffer[i] = UNKNOWN;
+    }
+    array_buffer = UNKNOWN;
+    uniform_buffer = UNKNOWN;
+    texture_buffer_buffer = UNKNOWN;
+}
+
+/* function to compare every known binding of the active unit with OpenGL */
+/* (throws std::runtime_error on the first mismatch)                       */
+void GLState::Validate() const
+{
+    Check(GL_CURRENT_PROGRAM, program);
+    Check(GL_VERTEX_ARRAY_BINDING, vertex_array);
+    Check(GL_ARRAY_BUFFER_BINDING, array_buffer);
+    Check(GL_UNIFORM_BUFFER_BINDING, uniform_buffer);
+    Check(GL_TEXTURE_BUFFER, texture_buffer_buffer);
+    if(active_texture != UNKNOWN)
+    {
+        Check(GL_ACTIVE_TEXTURE, GL_TEXTURE0 + active_texture);
+        Check(GL_TEXTURE_BINDING_2D, texture_2d[active_texture]);
+        Check(GL_TEXTURE_BINDING_BUFFER, texture_buffer[active_texture]);
+    }
+}
+
+void GLState::SetValidation(bool enable)
+{
+    validation = enable;
+}
+
+bool GLState::IsValidation() const
+{
+    return validation;
+}
+
+/* function to start counting the calls of a new frame */
+void GLState::ResetStats()
+{
+    stats.Reset();
+}
+
+const GLStateStats& GLState::GetStats() const
+{
+    return stats;
+}
+
+/* function to update a cached binding, returns true if the call has to be issued */
+bool GLState::Issue(GL_STATE_TYPE type, unsigned int* cached, unsigned int value, unsigned int query)
+{
+    if(*cached == value)
+    {
+        if(validation == true)
+            Check(query, value);
+        stats.skipped[static_cast<int>(type)] += 1;
+        return false;
+    }
+    *cached = value;
+    stats.issued[static_cast<int>(type)] += 1;
+    return true;
+}
+
+/* function to return the cached texture of 'target' on the active unit (nullptr if untracked) */
+unsigned int* GLState::TextureBinding(unsigned int target, unsigned int* query)
+{
+    if(active_texture == UNKNOWN)
+        return nullptr;
+
+    if(target == GL_TEXTURE_2D)
+    {
+        *query = GL_TEXTURE_BINDING_2D;
+        return &texture_2d[active_texture];
+    }
+    if(target == GL_TEXTURE_BUFFER)
+    {
+        *query = GL_TEXTURE_BINDING_BUFFER;
+        return &texture_buffer[active_texture];
+    }
+    return nullptr;
+}
+
+/* function to return the cached buffer of 'target' (nullptr if untracked) */
+unsigned int* GLState::BufferBinding(unsigned int target, unsigned int* query)
+{
+    if(target == GL_ARRAY_BUFFER)
+    {
+        *query = GL_ARRAY_BUFFER_BINDING;
+        return &array_buffer;
+    }
+    if(target == GL_UNIFORM_BUFFER)
+    {
+        *query = GL_UNIFORM_BUFFER_BINDING;
+        return &uniform_buffer;
+    }
+    if(target == GL_TEXTURE_BUFFER)
+    {
+        *query = GL_TEXTURE_BUFFER;
+        return &texture_buffer_buffer;
+    }
+    return nullptr;
+}
+
+/* function to compare a cached binding with glGet (unknown bindings are not checked) */
+void GLState::Check(unsigned int query, unsigned int cached) const
+{
+    if(cached == UNKNOWN)
+        return;
+
+    int actual = 0;
+    glGetIntegerv(query, &actual);
+    if(static_cast<unsigned int>(actual) != cached)
+    {
+        std::ostringstream message;
+        message << "class 'GLState' error: query 0x" << std::hex << query << std::dec
+                << " is " << actual << " but the cache has " << cached << ".";
+        throw std::runtime_error(message.str());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+/***************************/
+/*  FILE NAME: gl_state.h  */
+/***************************/
+#ifndef _GL_STATE_H_
+#define _GL_STATE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <stdexcept>
+#include <string>
+#include <cstddef>
+
+/************************************/
+/*  ENUM CLASS NAME: GL_STATE_TYPE  */
+/************************************/
+enum class GL_STATE_TYPE
+{
+    PROGRAM,
+    VERTEX_ARRAY,
+    ACTIVE_TEXTURE,
+    TEXTURE,
+    BUFFER,
+    COUNT
+}; // enum class GL_STATE_TYPE
+
+/******************************/
+/*  CLASS NAME: GLStateStats  */
+/******************************/
+/* calls that reached OpenGL and calls skipped because they were no-ops */
+class GLStateStats
+{
+public:
+    GLStateStats();
+    GLStateStats(const GLStateStats& other);
+
+public:
+    void Reset();
+    unsigned int Issued() const;
+    unsigned int Skipped() const;
+
+public:
+    unsigned int issued[static_cast<int>(GL_STATE_TYPE::COUNT)];
+    unsigned int skipped[static_cast<int>(GL_STATE_TYPE::COUNT)];
+}; // class GLStateStats
+
+/*************************/
+/*  CLASS NAME: GLState  */
+/*************************/
+/* cache of the bindings of the current context. the renderer binds through */
+/* it, so a bind of what is already bound is skipped and nothing has to be   */
+/* reset to 0 after use. with validation on (default in DEBUG builds) every  */
+/* skipped call is checked against glGet, and a mismatch throws.             */
+/* NOTE: GL_ELEMENT_ARRAY_BUFFER is vertex array state and is never cached   */
+class GLState
+{
+public:
+    static constexpr unsigned int MAX_TEXTURE_UNITS = 16U;
+
+private:
+    GLState();
+    GLState(const GLState&) = delete;
+    GLState& operator=(const GLState&) = delete;
+
+public:
+    static GLState& Get();
+
+public:
+    void UseProgram(unsigned int program);
+    void BindVertexArray(unsigned int vertex_array);
+    void ActiveTexture(unsigned int unit);
+    void BindTexture(unsigned int target, unsigned int texture);
+    void BindBuffer(unsigned int target, unsigned int buffer);
+    void BindBufferBase(unsigned int target, unsigned int index, unsigned int buffer);
+    void BindBufferRange(unsigned int target, unsigned int index, unsigned int buffer, std::size_t offset, std::size_t size);
+
+    void DeleteProgram(unsigned int program);
+    void DeleteVertexArray(unsigned int vertex_array);
+    void DeleteTexture(unsigned int texture);
+    void DeleteBuffer(unsigned int buffer);
+
+public:
+    void Invalidate();
+    void Validate() const;
+    void SetValidation(bool enable);
+    bool IsValidation() const;
+    void ResetStats();
+    const GLStateStats& GetStats() const;
+
+private:
+    bool Issue(GL_STATE_TYPE type, unsigned int* cached, unsigned int value, unsigned int query);
+    unsigned int* TextureBinding(unsigned int target, unsigned int* query);
+    unsigned int* BufferBinding(unsigned int target, unsigned int* query);
+    void Check(unsigned int query, unsigned int cached) const;
+
+private:
+    unsigned int program;
+    unsigned int vertex_array;
+    unsigned int active_texture;
+    unsigned int texture_2d[MAX_TEXTURE_UNITS];
+    unsigned int texture_buffer[MAX_TEXTURE_UNITS];
+    unsigned int array_buffer;
+    unsigned int uniform_buffer;
+    unsigned int texture_buffer_buffer;
+    bool validation;
+    GLStateStats stats;
+}; // class GLState
+#endif // !_GL_STATE_H_
\ No newline at end of file
@@ -0,0 +1,157 @@
+/******************************/
+/*  FILE NAME: gpu_timer.cpp  */
+/******************************/
+#include "gpu_timer.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <GL/glew.h>
+#include "Profiler/profiler.h"
+
+/* default constructor */
+GpuTiming::GpuTiming()
+    : name("")
+    , begin_query(0)
+    , end_query(0)
+    , ended(false)
+{ /* empty */ }
+
+/* copy constructor */
+GpuTiming::GpuTiming(const GpuTiming& other)
+    : name(other.name)
+    , begin_query(other.begin_query)
+    , end_query(other.end_query)
+    , ended(other.ended)
+{ /* empty */ }
+
+
+/* default constructor */
+GpuTimer::GpuTimer()
+    : supported(false)
+    , clock_offset(0.0)
+    , free_queries()
+    , timings()
+    , open_timings()
+{ /* empty */ }
+
+/* destructor */
+GpuTimer::~GpuTimer()
+{
+    CleanupTimer();
+}
+
+/* function to make the queries and map the GPU clock to the profiler's */
+void GpuTimer::SetupTimer()
+{
+    supported = (GLEW_VERSION_3_3 || GLEW_ARB_timer_query);
+    if(supported == false)
+        return;
+
+    free_queries.resize(MAX_QUERIES);
+    glGenQueries(static_cast<GLsizei>(free_queries.size()), free_queries.data());
+
+    GLint64 gpu_time = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpu_time);
+    clock_offset = Profiler::Get().Now() - static_cast<double>(gpu_time) / 1000.0;
+}
+
+/* function to delete the queries, the timings not read yet are lost */
+void GpuTimer::CleanupTimer()
+{
+    for(const auto& timing : timings)
+    {
+        free_queries.push_back(timing.begin_query);
+        free_queries.push_back(timing.end_query);
+    }
+    timings.clear();
+    open_timings.clear();
+
+    if(free_queries.empty() == false)
+        glDeleteQueries(static_cast<GLsizei>(free_queries.size()), free_queries.data());
+    free_queries.clear();
+}
+
+/* function to start timing 'name' (a string literal), zones may nest         */
+/* NOTE: when every query is in flight the zone is skipped, End() matches it */
+void GpuTimer::Begin(const char* name)
+{
+    if(supported == false || free_queries.size() < 2)
+    {
+        open_timings.push_back(static_cast<std::size_t>(-1));
+        return;
+    }
+
+    GpuTiming timing;
+    timing.name = name;
+    timing.begin_query = free_queries.back();
+    free_queries.pop_back();
+    timing.end_query = free_queries.back();
+    free_queries.pop_back();
+    glQueryCounter(timing.begin_query, GL_TIMESTAMP);
+
+    open_timings.push_back(timings.size());
+    timings.push_back(timing);
+}
+
+/* function to end the last zone begun */
+void GpuTimer::End()
+{
+    if(open_timings.empty())
+        return;
+
+    const std::size_t index = open_timings.back();
+    open_timings.pop_back();
+    if(index == static_cast<std::size_t>(-1))
+        return;
+
+    glQueryCounter(timings[index].end_query, GL_TIMESTAMP);
+    timings[index].ended = true;
+}
+
+/* function to record the timings whose results are ready, in issue order          */
+/* ('wait' reads all ended ones, e.g. before a trace is written or the context goes) */
+void GpuTimer::Collect(bool wait)
+{
+    while(timings.empty() == false && timings.front().ended && open_timings.empty())
+    {
+        const GpuTiming& timing = timings.front();
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(timing.end_query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if(available == GL_FALSE && wait == false)
+            return;
+
+        GLuint64 begin_time = 0;
+        GLuint64 end_time = 0;
+        glGetQueryObjectui64v(timing.begin_query, GL_QUERY_RESULT, &begin_time);
+        glGetQueryObjectui64v(timing.end_query, GL_QUERY_RESULT, &end_time);
+        Profiler::Get().RecordGpu(timing.name, static_cast<double>(begin_time) / 1000.0 + clock_offset,
+                                  static_cast<double>(end_time) / 1000.0 + clock_offset);
+
+        free_queries.push_back(timing.begin_query);
+        free_queries.push_back(timing.end_query);
+        timings.pop_front();
+    }
+}
+
+/* function to return whether the context has timestamp queries */
+bool GpuTimer::IsSupported() const
+{
+    return supported;
+}
+
+
+/* constructor */
+GpuZone::GpuZone(GpuTimer* timer, const char* name)
+    : timer((timer != nullptr && Profiler::Get().IsCapturing()) ? timer : nullptr)
+{
+    if(this->timer != nullptr)
+        this->timer->Begin(name);
+}
+
+/* destructor */
+GpuZone::~GpuZone()
+{
+    if(timer != nullptr)
+        timer->End();
+}
\ No newline at end of file
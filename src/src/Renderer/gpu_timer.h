@@ -0,0 +1,87 @@
+/****************************/
+/*  FILE NAME: gpu_timer.h  */
+/****************************/
+#ifndef _GPU_TIMER_H_
+#define _GPU_TIMER_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <deque>
+#include <vector>
+#include <cstddef>
+
+/***************************/
+/*  CLASS NAME: GpuTiming  */
+/***************************/
+/* a pair of timestamp queries around a GPU zone */
+class GpuTiming
+{
+public:
+    GpuTiming();
+    GpuTiming(const GpuTiming& other);
+
+public:
+    const char* name;
+    unsigned int begin_query;
+    unsigned int end_query;
+    bool ended;
+}; // class GpuTiming
+
+/**************************/
+/*  CLASS NAME: GpuTimer  */
+/**************************/
+/* GPU times of zones (GpuZone) from GL_TIMESTAMP queries (GL 3.3 or         */
+/* ARB_timer_query), recorded to the GPU track of the Profiler. the results  */
+/* are read a few frames later, when ready, so the CPU never waits for them. */
+/* the GPU clock is mapped to the profiler's once at setup.                  */
+class GpuTimer
+{
+public:
+    static constexpr std::size_t MAX_QUERIES = 256U;
+
+public:
+    GpuTimer();
+    GpuTimer(const GpuTimer& other) = delete;
+    ~GpuTimer();
+
+public:
+    GpuTimer& operator=(const GpuTimer& rhs) = delete;
+
+public:
+    void SetupTimer();
+    void CleanupTimer();
+    void Begin(const char* name);
+    void End();
+    void Collect(bool wait);
+
+public:
+    bool IsSupported() const;
+
+private:
+    bool supported;
+    double clock_offset;                /* profiler microseconds minus GPU microseconds */
+    std::vector<unsigned int> free_queries;
+    std::deque<GpuTiming> timings;      /* in issue order, the open ones at the back */
+    std::vector<std::size_t> open_timings;
+}; // class GpuTimer
+
+/*************************/
+/*  CLASS NAME: GpuZone  */
+/*************************/
+/* times the GPU work submitted in its scope, if there is a timer and the */
+/* profiler is capturing                                                   */
+class GpuZone
+{
+public:
+    GpuZone(GpuTimer* timer, const char* name);
+    GpuZone(const GpuZone& other) = delete;
+    ~GpuZone();
+
+public:
+    GpuZone& operator=(const GpuZone& rhs) = delete;
+
+private:
+    GpuTimer* timer;
+}; // class GpuZone
+#endif // !_GPU_TIMER_H_
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*************************************/
+/*  FILE NAME: headless_context.cpp  */
+/*************************************/
+#include "headless_context.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <cstring>
+#include <stdexcept>
+#ifdef GLTF_ANIMATION_HEADLESS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+/* default constructor */
+HeadlessContext::HeadlessContext()
+    : display(nullptr)
+    , surface(nullptr)
+    , context(nullptr)
+{ /* empty */ }
+
+/* destructor */
+HeadlessContext::~HeadlessContext()
+{
+    CleanupContext();
+}
+
+#ifdef GLTF_ANIMATION_HEADLESS
+/* function to return the surfaceless display of Mesa if the client offers it */
+static EGLDisplay GetDisplay()
+{
+    const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if(extensions != nullptr && std::strstr(extensions, "EGL_MESA_platform_surfaceless") != nullptr)
+    {
+        auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if(get_platform_display != nullptr)
+        {
+            EGLDisplay display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if(display != EGL_NO_DISPLAY)
+                return display;
+        }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+/* function to create a core profile context and make it current */
+void HeadlessContext::SetupContext(int major_version, int minor_version)
+{
+    CleanupContext();
+
+    display = GetDisplay();
+    if(display == EGL_NO_DISPLAY || eglInitialize(static_cast<EGLDisplay>(display), nullptr, nullptr) == EGL_FALSE)
+    {
+        display = nullptr;
+        throw std::runtime_error("class 'HeadlessContext' error: failed to initialize the EGL display.");
+    }
+
+    const EGLint config_attributes[] =
+    {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_NONE
+    };
+    EGLConfig config = nullptr;
+    EGLint num_configs = 0;
+    if(eglChooseConfig(static_cast<EGLDisplay>(display), config_attributes, &config, 1, &num_configs) == EGL_FALSE || num_configs == 0)
+        throw std::runtime_error("class 'HeadlessContext' error: no EGL config supports desktop OpenGL.");
+
+    const EGLint surface_attributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    surface = eglCreatePbufferSurface(static_cast<EGLDisplay>(display), config, surface_attributes);
+    if(surface == EGL_NO_SURFACE)
+        throw std::runtime_error("class 'HeadlessContext' error: failed to create the pbuffer surface.");
+
+    const EGLint context_attributes[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION, major_version,
+        EGL_CONTEXT_MINOR_VERSION, minor_version,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    eglBindAPI(EGL_OPENGL_API);
+    context = eglCreateContext(static_cast<EGLDisplay>(display), config, EGL_NO_CONTEXT, context_attributes);
+    if(context == EGL_NO_CONTEXT)
+        throw std::runtime_error("class 'HeadlessContext' error: failed to create the OpenGL context.");
+
+    if(eglMakeCurrent(static_cast<EGLDisplay>(display), surface, surface, context) == EGL_FALSE)
+        throw std::runtime_error("class 'HeadlessContext' error: failed to make the context current.");
+
+    /* there is no window to present to, so never wait for a vertical sync */
+    eglSwapInterval(static_cast<EGLDisplay>(display), 0);
+}
+
+void HeadlessContext::CleanupContext()
+{
+    if(display == nullptr)
+        return;
+
+    eglMakeCurrent(static_cast<EGLDisplay>(display), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if(context != nullptr)
+        eglDestroyContext(static_cast<EGLDisplay>(display), static_cast<EGLContext>(context));
+    if(surface != nullptr)
+        eglDestroySurface(static_cast<EGLDisplay>(display), static_cast<EGLSurface>(surface));
+    eglTerminate(static_cast<EGLDisplay>(display));
+
+    display = nullptr;
+    surface = nullptr;
+    context = nullptr;
+}
+#else
+void HeadlessContext::SetupContext(int major_version, int minor_version)
+{
+    throw std::runtime_error("class 'HeadlessContext' error: the program was built without EGL.");
+}
+
+void HeadlessContext::CleanupContext()
+{ /* empty */ }
+#endif
+
+/* function to return true once the context is made current */
+bool HeadlessContext::IsCurrent() const
+{
+    return (context != nullptr);
+}
\ No newline at end of file
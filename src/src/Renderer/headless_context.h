@@ -0,0 +1,36 @@
+/***********************************/
+/*  FILE NAME: headless_context.h  */
+/***********************************/
+#ifndef _HEADLESS_CONTEXT_H_
+#define _HEADLESS_CONTEXT_H_
+
+/*********************************/
+/*  CLASS NAME: HeadlessContext  */
+/*********************************/
+/* OpenGL core context made current without a window, through EGL. the     */
+/* display is Mesa's surfaceless platform when it is offered (no X server  */
+/* or GPU needed, llvmpipe renders), the default display otherwise. the    */
+/* surface is a 1x1 pbuffer, frames are drawn into an OffscreenTarget.     */
+/* NOTE: without GLTF_ANIMATION_HEADLESS (EGL not found) SetupContext()    */
+/*       throws.                                                           */
+class HeadlessContext
+{
+public:
+    HeadlessContext();
+    HeadlessContext(const HeadlessContext& other) = delete;
+    ~HeadlessContext();
+
+public:
+    HeadlessContext& operator=(const HeadlessContext& rhs) = delete;
+
+public:
+    void SetupContext(int major_version, int minor_version);
+    void CleanupContext();
+    bool IsCurrent() const;
+
+private:
+    void* display;
+    void* surface;
+    void* context;
+}; // class HeadlessContext
+#endif // !_HEADLESS_CONTEXT_H_
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*************************************/
+/*  FILE NAME: offscreen_target.cpp  */
+/*************************************/
+#include "offscreen_target.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <stdexcept>
+#include <GL/glew.h>
+
+/* default constructor */
+OffscreenTarget::OffscreenTarget()
+    : framebuffer(0)
+    , color_buffer(0)
+    , depth_buffer(0)
+    , width(0)
+    , height(0)
+{ /* empty */ }
+
+/* destructor */
+OffscreenTarget::~OffscreenTarget()
+{
+    CleanupTarget();
+}
+
+/* function to create the framebuffer and its 'width' x 'height' attachments */
+void OffscreenTarget::SetupTarget(int width, int height)
+{
+    CleanupTarget();
+
+    this->width = width;
+    this->height = height;
+
+    glGenRenderbuffers(1, &color_buffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, color_buffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+    glGenRenderbuffers(1, &depth_buffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_buffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color_buffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_buffer);
+
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        throw std::runtime_error("class 'OffscreenTarget' error: the framebuffer is incomplete.");
+}
+
+void OffscreenTarget::CleanupTarget()
+{
+    if(framebuffer != 0)
+        glDeleteFramebuffers(1, &framebuffer);
+    if(color_buffer != 0)
+        glDeleteRenderbuffers(1, &color_buffer);
+    if(depth_buffer != 0)
+        glDeleteRenderbuffers(1, &depth_buffer);
+
+    framebuffer = 0;
+    color_buffer = 0;
+    depth_buffer = 0;
+}
+
+/* function to draw into the target with a viewport covering it */
+void OffscreenTarget::Bind() const
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, width, height);
+}
+
+unsigned int OffscreenTarget::GetFramebuffer() const
+{
+    return framebuffer;
+}
+
+int OffscreenTarget::GetWidth() const
+{
+    return width;
+}
+
+int OffscreenTarget::GetHeight() const
+{
+    return height;
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+/***********************************/
+/*  FILE NAME: offscreen_target.h  */
+/***********************************/
+#ifndef _OFFSCREEN_TARGET_H_
+#define _OFFSCREEN_TARGET_H_
+
+/*********************************/
+/*  CLASS NAME: OffscreenTarget  */
+/*********************************/
+/* framebuffer object with a color and a depth renderbuffer, drawn into */
+/* instead of a window                                                   */
+class OffscreenTarget
+{
+public:
+    OffscreenTarget();
+    OffscreenTarget(const OffscreenTarget& other) = delete;
+    ~OffscreenTarget();
+
+public:
+    OffscreenTarget& operator=(const OffscreenTarget& rhs) = delete;
+
+public:
+    void SetupTarget(int width, int height);
+    void CleanupTarget();
+    void Bind() const;
+
+public:
+    unsigned int GetFramebuffer() const;
+    int GetWidth() const;
+    int GetHeight() const;
+
+private:
+    unsigned int framebuffer;
+    unsigned int color_buffer;
+    unsigned int depth_buffer;
+    int width;
+    int height;
+}; // class OffscreenTarget
+#endif // !_OFFSCREEN_TARGET_H_
\ No newline at end of file
@@ -0,0 +1,220 @@
+/********************************/
+/*  FILE NAME: upload_ring.cpp  */
+/********************************/
+#include "upload_ring.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <stdexcept>
+#include <GL/glew.h>
+#include "gl_state.h"
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+/* flags of the buffer storage and of its mapping */
+static constexpr GLbitfield PERSISTENT_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+/* fence wait per try, in nanoseconds */
+static constexpr GLuint64 FENCE_TIMEOUT = 1000000000ULL;
+
+/* default constructor */
+UploadAllocation::UploadAllocation()
+    : data(nullptr)
+    , offset(0)
+    , size(0)
+{ /* empty */ }
+
+/* copy constructor */
+UploadAllocation::UploadAllocation(const UploadAllocation& other)
+    : data(other.data)
+    , offset(other.offset)
+    , size(other.size)
+{ /* empty */ }
+
+
+/* default constructor */
+UploadRing::UploadRing()
+    : buffer(0)
+    , frame_size(0)
+    , region(FRAME_COUNT - 1)
+    , head(0)
+    , flushed(0)
+    , persistent(false)
+    , mapped(nullptr)
+    , staging()
+    , fences()
+    , fence_waits(0)
+    , stalls(0)
+    , frame_number(0)
+{ /* empty */ }
+
+/* destructor */
+UploadRing::~UploadRing()
+{
+    CleanupRing();
+}
+
+/* function to create the buffer of FRAME_COUNT regions of 'frame_size' bytes */
+void UploadRing::SetupRing(std::size_t frame_size)
+{
+    CleanupRing();
+
+    this->frame_size = frame_size;
+    const GLsizeiptr bytes = static_cast<GLsizeiptr>(frame_size * FRAME_COUNT);
+
+    glGenBuffers(1, &buffer);
+    GLState::Get().BindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    persistent = (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage);
+    if(persistent == true)
+    {
+        glBufferStorage(GL_ARRAY_BUFFER, bytes, nullptr, PERSISTENT_FLAGS);
+        mapped = static_cast<unsigned char*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, bytes, PERSISTENT_FLAGS));
+        if(mapped == nullptr)
+            throw std::runtime_error("class 'UploadRing' error: failed to map the buffer.");
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+        staging.resize(frame_size);
+    }
+
+    region = FRAME_COUNT - 1;
+    head = 0;
+    flushed = 0;
+    fence_waits = 0;
+    stalls = 0;
+}
+
+/* function to clean up the buffer and the fences */
+void UploadRing::CleanupRing()
+{
+    for(unsigned int i = 0; i < FRAME_COUNT; ++i)
+    {
+        if(fences[i] != nullptr)
+            glDeleteSync(static_cast<GLsync>(fences[i]));
+        fences[i] = nullptr;
+    }
+
+    if(buffer != 0)
+    {
+        if(mapped != nullptr)
+        {
+            GLState::Get().BindBuffer(GL_ARRAY_BUFFER, buffer);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+        GLState::Get().DeleteBuffer(buffer);
+    }
+
+    buffer = 0;
+    mapped = nullptr;
+    staging.clear();
+}
+
+/* function to move to the next region                                   */
+/* NOTE: waits for the draws of FRAME_COUNT frames ago if they still run */
+void UploadRing::BeginFrame()
+{
+    region = (region + 1) % FRAME_COUNT;
+    frame_number += 1;
+    head = 0;
+    flushed = 0;
+
+    GLsync fence = static_cast<GLsync>(fences[region]);
+    if(fence == nullptr)
+        return;
+
+    fence_waits += 1;
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if(result == GL_TIMEOUT_EXPIRED)
+    {
+        stalls += 1;
+        do result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+        while(result == GL_TIMEOUT_EXPIRED);
+    }
+    if(result == GL_WAIT_FAILED)
+        throw std::runtime_error("class 'UploadRing' error: failed to wait for a frame fence.");
+
+    glDeleteSync(fence);
+    fences[region] = nullptr;
+}
+
+/* function to reserve 'size' bytes of the current region at a multiple of 'alignment' */
+/* (the offset is from the start of the buffer, so it can be bound or addressed as is) */
+UploadAllocation UploadRing::Allocate(std::size_t size, std::size_t alignment)
+{
+    const std::size_t base = frame_size * region;
+    const std::size_t absolute = base + head;
+    const std::size_t aligned = (alignment > 1) ? (absolute + alignment - 1) / alignment * alignment : absolute;
+    if(aligned + size > base + frame_size)
+        throw std::runtime_error("class 'UploadRing' error: the frame region is full.");
+
+    UploadAllocation allocation;
+    allocation.offset = aligned;
+    allocation.size = size;
+    allocation.data = (persistent == true) ? static_cast<void*>(mapped + aligned) : static_cast<void*>(staging.data() + (aligned - base));
+    head = aligned + size - base;
+    return allocation;
+}
+
+/* function to make the writes since the last Flush() visible to the GPU       */
+/* (nothing to do with the coherent mapping, glBufferSubData of the staging)   */
+void UploadRing::Flush()
+{
+    if(persistent == true || head == flushed)
+        return;
+
+    GLState::Get().BindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(frame_size * region + flushed), static_cast<GLsizeiptr>(head - flushed), staging.data() + flushed);
+    flushed = head;
+}
+
+/* function to fence the draws that read the current region */
+void UploadRing::EndFrame()
+{
+    Flush();
+    fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+/* function to return the OpenGL buffer object of the ring */
+unsigned int UploadRing::GetBuffer() const
+{
+    return buffer;
+}
+
+/* function to return the bytes of one region */
+std::size_t UploadRing::FrameSize() const
+{
+    return frame_size;
+}
+
+/* function to return the bytes allocated in the current region */
+std::size_t UploadRing::UsedBytes() const
+{
+    return head;
+}
+
+/* function to return the number of the current frame (BeginFrame() calls so far) */
+std::uint64_t UploadRing::FrameNumber() const
+{
+    return frame_number;
+}
+
+/* function to return the number of BeginFrame() calls that found the fence of their region */
+unsigned int UploadRing::FenceWaits() const
+{
+    return fence_waits;
+}
+
+/* function to return the number of BeginFrame() calls that had to wait */
+unsigned int UploadRing::Stalls() const
+{
+    return stalls;
+}
+
+/* function to return true if the buffer is persistently mapped */
+bool UploadRing::IsPersistent() const
+{
+    return persistent;
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+/******************************/
+/*  FILE NAME: upload_ring.h  */
+/******************************/
+#ifndef _UPLOAD_RING_H_
+#define _UPLOAD_RING_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**********************************/
+/*  CLASS NAME: UploadAllocation  */
+/**********************************/
+/* memory of the current frame returned by UploadRing::Allocate() */
+class UploadAllocation
+{
+public:
+    UploadAllocation();
+    UploadAllocation(const UploadAllocation& other);
+
+public:
+    void* data;             /* write pointer, valid until EndFrame()       */
+    std::size_t offset;     /* byte offset of 'data' in the ring's buffer  */
+    std::size_t size;
+}; // class UploadAllocation
+
+/****************************/
+/*  CLASS NAME: UploadRing  */
+/****************************/
+/* streaming upload allocator on one buffer split into FRAME_COUNT regions.  */
+/* each frame the CPU writes the next region while the GPU still reads the   */
+/* previous ones, and a fence per region keeps the CPU from overwriting a    */
+/* region before the draws that read it are done. the buffer is persistently */
+/* and coherently mapped (GL 4.4 or ARB_buffer_storage), so writing is a     */
+/* plain memcpy. without buffer storage the writes go to a staging copy that */
+/* Flush() sends with glBufferSubData.                                       */
+class UploadRing
+{
+public:
+    static constexpr unsigned int FRAME_COUNT = 3U;
+
+public:
+    UploadRing();
+    UploadRing(const UploadRing& other) = delete;
+    ~UploadRing();
+
+public:
+    UploadRing& operator=(const UploadRing& rhs) = delete;
+
+public:
+    void SetupRing(std::size_t frame_size);
+    void CleanupRing();
+    void BeginFrame();
+    UploadAllocation Allocate(std::size_t size, std::size_t alignment);
+    void Flush();
+    void EndFrame();
+
+public:
+    unsigned int GetBuffer() const;
+    std::size_t FrameSize() const;
+    std::size_t UsedBytes() const;
+    std::uint64_t FrameNumber() const;
+    unsigned int FenceWaits() const;
+    unsigned int Stalls() const;
+    bool IsPersistent() const;
+
+private:
+    unsigned int buffer;
+    std::size_t frame_size;
+    unsigned int region;
+    std::size_t head;
+    std::size_t flushed;
+    bool persistent;
+    unsigned char* mapped;
+    std::vector<unsigned char> staging;
+    void* fences[FRAME_COUNT];
+    unsigned int fence_waits;   /* fences checked when their region came back */
+    unsigned int stalls;    /* fences that were not signaled yet when their region came back */
+    std::uint64_t frame_number;     /* calls of BeginFrame() */
+}; // class UploadRing
+#endif // !_UPLOAD_RING_H_
\ No newline at end of file
@@ -0,0 +1,260 @@
+/**********************************/
+/*  FILE NAME: program_cache.cpp  */
+/**********************************/
+#include "program_cache.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <filesystem>
+#include <GL/glew.h>
+
+/***************/
+/*  CONSTANTS  */
+/***************/
+// first bytes of a cache file and its layout version
+static constexpr char CACHE_MAGIC[4] = { 'G', 'L', 'P', 'B' };
+static constexpr std::uint32_t CACHE_VERSION = 1;
+// seed of the FNV-1a hash
+static constexpr std::uint64_t HASH_SEED = 14695981039346656037ULL;
+
+// function that returns the milliseconds since 'start'
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// function that returns a GL string, or an empty string without a context
+static std::string getGLString(GLenum name)
+{
+    const GLubyte* str = glGetString(name);
+    return (str != nullptr) ? std::string(reinterpret_cast<const char*>(str)) : std::string();
+}
+
+// default constructor
+ProgramCacheStats::ProgramCacheStats()
+    : hits(0)
+    , misses(0)
+    , rejected(0)
+    , load_time(0.0)
+    , compile_time(0.0)
+    , saved_time(0.0)
+{ /* empty */ }
+
+// copy constructor
+ProgramCacheStats::ProgramCacheStats(const ProgramCacheStats& other)
+    : hits(other.hits)
+    , misses(other.misses)
+    , rejected(other.rejected)
+    , load_time(other.load_time)
+    , compile_time(other.compile_time)
+    , saved_time(other.saved_time)
+{ /* empty */ }
+
+
+// constructor (the OpenGL context must be current)
+ProgramCache::ProgramCache(const std::string& directory)
+    : directory(directory)
+    , driver(getGLString(GL_VENDOR) + '|' + getGLString(GL_RENDERER) + '|' + getGLString(GL_VERSION))
+    , supported(false)
+    , stats()
+{
+    // program binaries need GL 4.1 or ARB_get_program_binary, and at least one binary format
+    GLint num_formats = 0;
+    if (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary)
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+    supported = (num_formats > 0);
+
+    std::error_code error;
+    if (supported)
+        std::filesystem::create_directories(directory, error);
+    if (error)
+        supported = false;
+}
+
+// function that returns true if programs can be stored and loaded
+bool ProgramCache::isSupported() const
+{
+    return supported;
+}
+
+// function that returns the key of a program made of these sources on this driver
+std::uint64_t ProgramCache::makeKey(const std::string& vert_source, const std::string& frag_source) const
+{
+    std::uint64_t key = hashString(vert_source, HASH_SEED);
+    key = hashString(std::string(1, '\0') + frag_source, key);
+    return hashString(std::string(1, '\0') + driver, key);
+}
+
+// function to link 'program' from the cached binary of 'key'.
+// returns false on a miss or if the driver refused the binary, the program
+// is then unlinked and can still be compiled and linked as usual.
+bool ProgramCache::load(unsigned int program, std::uint64_t key)
+{
+    if (!supported)
+        return false;
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::string path = getPath(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (file.is_open() == false)
+    {
+        stats.misses += 1;
+        return false;
+    }
+    const std::uint64_t file_size = static_cast<std::uint64_t>(file.tellg());
+    file.seekg(0);
+
+    // stale or damaged, compiled again and rewritten by the caller
+    auto reject = [&]()
+    {
+        file.close();
+        std::remove(path.c_str());
+        stats.misses += 1;
+        stats.rejected += 1;
+        return false;
+    };
+    // a length read from the file is checked against the bytes left before anything is allocated
+    auto fits = [&](std::uint64_t length)
+    {
+        const std::streamoff offset = file.tellg();
+        return file.good() && offset >= 0 && length <= file_size - static_cast<std::uint64_t>(offset);
+    };
+
+    char magic[4] = {};
+    std::uint32_t version = 0;
+    std::uint64_t file_key = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&file_key), sizeof(file_key));
+    if (!file.good() || !std::equal(magic, magic + 4, CACHE_MAGIC) || version != CACHE_VERSION || file_key != key)
+        return reject();
+
+    std::uint32_t driver_length = 0;
+    file.read(reinterpret_cast<char*>(&driver_length), sizeof(driver_length));
+    if (!fits(driver_length) || driver_length != driver.size())
+        return reject();
+    std::string file_driver(driver_length, '\0');
+    file.read(&file_driver[0], driver_length);
+    if (!file.good() || file_driver != driver)
+        return reject();
+
+    double compile_time = 0.0;
+    std::uint32_t format = 0;
+    std::uint32_t length = 0;
+    file.read(reinterpret_cast<char*>(&compile_time), sizeof(compile_time));
+    file.read(reinterpret_cast<char*>(&format), sizeof(format));
+    file.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (!fits(length) || length == 0 || length > static_cast<std::uint32_t>(INT32_MAX))
+        return reject();
+    std::vector<char> binary(length);
+    file.read(binary.data(), length);
+    if (!file.good())
+        return reject();
+    file.close();
+
+    GLint status = GL_FALSE;
+    glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(length));
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+        return reject();
+
+    const double load_time = millisecondsSince(start);
+    stats.hits += 1;
+    stats.load_time += load_time;
+    stats.saved_time += compile_time - load_time;
+    return true;
+}
+
+// function to write the binary of the linked 'program' under 'key'.
+// 'compile_time' (milliseconds) is kept to report the time saved by later hits.
+// NOTE: the program must be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set
+void ProgramCache::store(unsigned int program, std::uint64_t key, double compile_time)
+{
+    stats.compile_time += compile_time;
+    if (!supported)
+        return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(static_cast<size_t>(length));
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    // written next to the final file and renamed, so a reader never sees half a file
+    const std::string path = getPath(key);
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (file.is_open() == false)
+            return;
+
+        const std::uint32_t driver_length = static_cast<std::uint32_t>(driver.size());
+        const std::uint32_t binary_format = static_cast<std::uint32_t>(format);
+        const std::uint32_t binary_length = static_cast<std::uint32_t>(length);
+        file.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        file.write(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION));
+        file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+        file.write(reinterpret_cast<const char*>(&driver_length), sizeof(driver_length));
+        file.write(driver.data(), driver_length);
+        file.write(reinterpret_cast<const char*>(&compile_time), sizeof(compile_time));
+        file.write(reinterpret_cast<const char*>(&binary_format), sizeof(binary_format));
+        file.write(reinterpret_cast<const char*>(&binary_length), sizeof(binary_length));
+        file.write(binary.data(), binary_length);
+        if (file.good() == false)
+            return;
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_path, path, error);
+}
+
+const ProgramCacheStats& ProgramCache::getStats() const
+{
+    return stats;
+}
+
+// function that returns a one line summary of the lookups
+std::string ProgramCache::report() const
+{
+    const unsigned int lookups = stats.hits + stats.misses;
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1);
+    if (!supported)
+        stream << "disabled (no program binary format)";
+    else
+        stream << stats.hits << "/" << lookups << " hits (" << (lookups > 0 ? 100.0 * stats.hits / lookups : 0.0) << "%), "
+               << stats.rejected << " rejected, " << stats.load_time << " ms loading, "
+               << stats.compile_time << " ms compiling, " << stats.saved_time << " ms saved";
+    return stream.str();
+}
+
+// function that returns the file of 'key'
+std::string ProgramCache::getPath(std::uint64_t key) const
+{
+    std::ostringstream stream;
+    stream << directory << '/' << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return stream.str();
+}
+
+// function that returns the 64 bit FNV-1a hash of 'str' continued from 'seed'
+std::uint64_t hashString(const std::string& str, std::uint64_t seed)
+{
+    std::uint64_t hash = seed;
+    for (unsigned char c : str)
+    {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/********************************/
+/*  FILE NAME: program_cache.h  */
+/********************************/
+#ifndef _PROGRAM_CACHE_H_
+#define _PROGRAM_CACHE_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <string>
+#include <cstdint>
+
+/***********************************/
+/*  CLASS NAME: ProgramCacheStats  */
+/***********************************/
+// lookups of a program cache and the time they took or saved
+class ProgramCacheStats
+{
+public:
+    ProgramCacheStats();
+    ProgramCacheStats(const ProgramCacheStats& other);
+
+public:
+    unsigned int hits;
+    unsigned int misses;
+    unsigned int rejected;      // found, but damaged, stale or refused by the driver (counted as misses too)
+    double load_time;           // milliseconds spent in glProgramBinary for the hits
+    double compile_time;        // milliseconds spent compiling and linking the misses
+    double saved_time;          // compile time stored with the hits minus their load time
+}; // class ProgramCacheStats
+
+/******************************/
+/*  CLASS NAME: ProgramCache  */
+/******************************/
+// on-disk cache of linked program binaries (glGetProgramBinary), one file
+// per program named by a hash of its sources and of the driver (vendor,
+// renderer, version). the driver string is also stored in the file and
+// compared on load, and a damaged file or a binary the driver refuses is
+// deleted, so the program is compiled again and the cache rewritten after
+// a driver update.
+class ProgramCache
+{
+private:
+    ProgramCache() = delete;
+    ProgramCache(const ProgramCache&) = delete;
+    ProgramCache& operator=(const ProgramCache&);
+
+public:
+    explicit ProgramCache(const std::string& directory);
+
+public:
+    bool isSupported() const;
+    std::uint64_t makeKey(const std::string& vert_source, const std::string& frag_source) const;
+    bool load(unsigned int program, std::uint64_t key);
+    void store(unsigned int program, std::uint64_t key, double compile_time);
+    const ProgramCacheStats& getStats() const;
+    std::string report() const;
+
+private:
+    std::string getPath(std::uint64_t key) const;
+
+private:
+    std::string directory;
+    std::string driver;
+    bool supported;
+    ProgramCacheStats stats;
+}; // class ProgramCache
+
+std::uint64_t hashString(const std::string& str, std::uint64_t seed);
+#endif // !_PROGRAM_CACHE_H_
\ No newline at end of file
@@ -8,6 +8,9 @@
 /**************/
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <chrono>
+#include "program_cache.h"
+#include "Renderer/gl_state.h"
 
 /*************************/
 /*  FUNCTION PROTOTYPES  */
@@ -18,13 +21,16 @@ void clearBuffer(char**);
 std::string getCompileError(unsigned int);
 std::string getLinkError(unsigned int);
 
-// constructor 
-Shader::Shader(const std::string& vert_file, const std::string& frag_file)
+// constructor (the program is taken from 'cache' if it holds it, and added to it otherwise)
+Shader::Shader(const std::string& vert_file, const std::string& frag_file, ProgramCache* cache)
     : program_id(static_cast<unsigned int>(-1))
     , vert_file(vert_file)
     , frag_file(frag_file)
+    , uniform_locations()
+    , uniform_block_indices()
 {
-    init();
+    init(cache);
+    reflect();
 }
 
 // destructor
@@ -34,41 +40,71 @@ Shader::~Shader()
 }
 
 // function to create shader program
-void Shader::init()
+void Shader::init(ProgramCache* cache)
+{
+    char* buffer = nullptr;
+
+    loadFromFile(vert_file, &buffer);
+    const std::string vert_source(buffer);
+    clearBuffer(&buffer);
+
+    loadFromFile(frag_file, &buffer);
+    const std::string frag_source(buffer);
+    clearBuffer(&buffer);
+
+    // a cached binary skips compiling and linking
+    std::uint64_t key = 0;
+    program_id = glCreateProgram();
+    if (cache != nullptr && cache->isSupported())
+    {
+        key = cache->makeKey(vert_source, frag_source);
+        if (cache->load(program_id, key))
+            return;
+
+        // a program refused by glProgramBinary is not linked again, start from a new one
+        GLState::Get().DeleteProgram(program_id);
+        program_id = glCreateProgram();
+        glProgramParameteri(program_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    compile(vert_source.c_str(), frag_source.c_str());
+    const double compile_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (cache != nullptr)
+        cache->store(program_id, key, compile_time);
+}
+
+// function to compile the shaders and link them into the program
+void Shader::compile(const char* vert_source, const char* frag_source)
 {
     unsigned int vertex_shader = static_cast<unsigned int>(-1);
     unsigned int fragment_shader = static_cast<unsigned int>(-1);
-    char* buffer = nullptr;
     int status = GL_FALSE;
 
     // create vertex shader
-    loadFromFile(vert_file, &buffer);
     {
         vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertex_shader, 1, &buffer, nullptr);
+        glShaderSource(vertex_shader, 1, &vert_source, nullptr);
 
         glCompileShader(vertex_shader);
         glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &status);
         if (status == GL_FALSE)
             throw std::runtime_error(getCompileError(vertex_shader));
     }
-    clearBuffer(&buffer);
 
     // create fragment shader
-    loadFromFile(frag_file, &buffer);
     {
         fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragment_shader, 1, &buffer, nullptr);
+        glShaderSource(fragment_shader, 1, &frag_source, nullptr);
 
         glCompileShader(fragment_shader);
         glGetShaderiv(fragment_shader, GL_COMPILE_STATUS, &status);
         if (status == GL_FALSE)
             throw std::runtime_error(getCompileError(fragment_shader));
     }
-    clearBuffer(&buffer);
 
-    // create shader program
-    program_id = glCreateProgram();
+    // link shader program
     glAttachShader(program_id, vertex_shader);
     glAttachShader(program_id, fragment_shader);
     glLinkProgram(program_id);
@@ -78,14 +114,82 @@ void Shader::init()
         throw std::runtime_error(getLinkError(program_id));
 
     // clean up vertex shader and fragment shader
+    glDetachShader(program_id, vertex_shader);
+    glDetachShader(program_id, fragment_shader);
     glDeleteShader(vertex_shader);
     glDeleteShader(fragment_shader);
 }
 
+// function to cache the locations of the active uniforms and the indices of the
+// active uniform blocks, so that no name is looked up in OpenGL after linking.
+// uniforms inside a block have no location and are only reachable through the block.
+void Shader::reflect()
+{
+    int num_uniforms = 0;
+    int max_name_length = 0;
+    glGetProgramiv(program_id, GL_ACTIVE_UNIFORMS, &num_uniforms);
+    glGetProgramiv(program_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+
+    std::string name(static_cast<size_t>(max_name_length), '\0');
+    for (int i = 0; i < num_uniforms; ++i)
+    {
+        int length = 0;
+        int size = 0;
+        unsigned int type = 0;
+        glGetActiveUniform(program_id, static_cast<unsigned int>(i), max_name_length, &length, &size, &type, &name[0]);
+
+        const std::string uniform_name = name.substr(0, static_cast<size_t>(length));
+        const int location = glGetUniformLocation(program_id, uniform_name.c_str());
+        if (location < 0)
+            continue;
+
+        // arrays are reported as 'name[0]', also register them as 'name'
+        uniform_locations[uniform_name] = location;
+        if (uniform_name.size() > 3 && uniform_name.compare(uniform_name.size() - 3, 3, "[0]") == 0)
+            uniform_locations[uniform_name.substr(0, uniform_name.size() - 3)] = location;
+    }
+
+    int num_blocks = 0;
+    int max_block_name_length = 0;
+    glGetProgramiv(program_id, GL_ACTIVE_UNIFORM_BLOCKS, &num_blocks);
+    glGetProgramiv(program_id, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &max_block_name_length);
+
+    std::string block_name(static_cast<size_t>(max_block_name_length), '\0');
+    for (int i = 0; i < num_blocks; ++i)
+    {
+        int length = 0;
+        glGetActiveUniformBlockName(program_id, static_cast<unsigned int>(i), max_block_name_length, &length, &block_name[0]);
+        uniform_block_indices[block_name.substr(0, static_cast<size_t>(length))] = static_cast<unsigned int>(i);
+    }
+}
+
 // function to clean up shader program
 void Shader::cleanup()
 {
-    glDeleteProgram(program_id);
+    GLState::Get().DeleteProgram(program_id);
+}
+
+// function that returns the cached location of a uniform (-1 if it is not active)
+int Shader::getUniformLocation(const std::string& name) const
+{
+    auto iter = uniform_locations.find(name);
+    return (iter != uniform_locations.end()) ? iter->second : -1;
+}
+
+// function that returns the cached index of a uniform block (GL_INVALID_INDEX if it is not active)
+unsigned int Shader::getUniformBlockIndex(const std::string& name) const
+{
+    auto iter = uniform_block_indices.find(name);
+    return (iter != uniform_block_indices.end()) ? iter->second : GL_INVALID_INDEX;
+}
+
+// function to connect a uniform block to a uniform buffer binding point
+// (does nothing if the program does not use the block)
+void Shader::bindUniformBlock(const std::string& name, unsigned int binding) const
+{
+    const unsigned int block_index = getUniformBlockIndex(name);
+    if (block_index != GL_INVALID_INDEX)
+        glUniformBlockBinding(program_id, block_index, binding);
 }
 
 // function to read file
@@ -12,11 +12,14 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include <cstring>
 #include <cstdlib>
 #include <cstdio>
 
+class ProgramCache;
+
 /************************/
 /*  CLASS NAME: Shader  */
 /************************/
@@ -28,20 +31,27 @@ private:
     Shader& operator=(const Shader&);
 
 public:
-    Shader(const std::string& vert_file, const std::string& frag_file);
+    Shader(const std::string& vert_file, const std::string& frag_file, ProgramCache* cache = nullptr);
     ~Shader();
 
 private:
-    void init();
+    void init(ProgramCache* cache);
+    void compile(const char* vert_source, const char* frag_source);
+    void reflect();
     void cleanup();
 
 public:
     unsigned int get() const;
+    int getUniformLocation(const std::string& name) const;
+    unsigned int getUniformBlockIndex(const std::string& name) const;
+    void bindUniformBlock(const std::string& name, unsigned int binding) const;
 
 private:
     unsigned int program_id;
     std::string vert_file;
     std::string frag_file;
+    std::unordered_map<std::string, int> uniform_locations;
+    std::unordered_map<std::string, unsigned int> uniform_block_indices;
 }; // class Shader
 
 inline unsigned int Shader::get() const { return program_id; }
@@ -0,0 +1,51 @@
+/***********************************/
+/*  FILE NAME: uniform_buffer.cpp  */
+/***********************************/
+#include "uniform_buffer.h"
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <GL/glew.h>
+#include "Renderer/gl_state.h"
+
+// constructor
+UniformBuffer::UniformBuffer(std::size_t size, unsigned int binding)
+    : buffer_id(0)
+    , size(size)
+    , binding(binding)
+{
+    init();
+}
+
+// destructor
+UniformBuffer::~UniformBuffer()
+{
+    cleanup();
+}
+
+// function to create the buffer and bind it to its binding point
+void UniformBuffer::init()
+{
+    glGenBuffers(1, &buffer_id);
+    GLState::Get().BindBuffer(GL_UNIFORM_BUFFER, buffer_id);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW);
+
+    GLState::Get().BindBufferBase(GL_UNIFORM_BUFFER, binding, buffer_id);
+}
+
+// function to clean up the buffer
+void UniformBuffer::cleanup()
+{
+    GLState::Get().DeleteBuffer(buffer_id);
+}
+
+// function to write 'size' bytes at 'offset' (std140 layout is up to the caller)
+void UniformBuffer::update(const void* data, std::size_t size, std::size_t offset)
+{
+    if (offset + size > this->size)
+        throw std::runtime_error("class 'UniformBuffer' error: update out of range.");
+
+    GLState::Get().BindBuffer(GL_UNIFORM_BUFFER, buffer_id);
+    glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+}
\ No newline at end of file
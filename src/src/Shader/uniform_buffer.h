@@ -0,0 +1,47 @@
+/*********************************/
+/*  FILE NAME: uniform_buffer.h  */
+/*********************************/
+#ifndef _UNIFORM_BUFFER_H_
+#define _UNIFORM_BUFFER_H_
+
+/**************/
+/*  INCLUDES  */
+/**************/
+#include <stdexcept>
+#include <cstddef>
+
+/*******************************/
+/*  CLASS NAME: UniformBuffer  */
+/*******************************/
+// uniform buffer object that stays bound to one binding point for its whole
+// lifetime, so every program whose block is bound to the same point
+// (Shader::bindUniformBlock) sees the data without any per-program call.
+class UniformBuffer
+{
+private:
+    UniformBuffer() = delete;
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&);
+
+public:
+    UniformBuffer(std::size_t size, unsigned int binding);
+    ~UniformBuffer();
+
+private:
+    void init();
+    void cleanup();
+
+public:
+    unsigned int get() const;
+    unsigned int getBinding() const;
+    void update(const void* data, std::size_t size, std::size_t offset);
+
+private:
+    unsigned int buffer_id;
+    std::size_t size;
+    unsigned int binding;
+}; // class UniformBuffer
+
+inline unsigned int UniformBuffer::get() const { return buffer_id; }
+inline unsigned int UniformBuffer::getBinding() const { return binding; }
+#endif // !_UNIFORM_BUFFER_H_
\ No newline at end of file